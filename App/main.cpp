@@ -80,6 +80,8 @@ int main()
   // Time manager
   chrono::CTimeManager* pTimeManager = chrono::CTimeManager::CreateSingleton();
   pTimeManager->SetTargetFramerate(144);
+  pTimeManager->SetFixedFramerate(60);
+  pTimeManager->SetSubsteps(2);
 
   // Create resource manager
   CResourceManager::CreateSingleton();
@@ -126,6 +128,7 @@ int main()
   game::CCollisionComponent* pCollComp = pFloor->RegisterComponent<game::CCollisionComponent>();
   pCollComp->CreateCollider(collision::EColliderType::BOX_COLLIDER);
   static_cast<collision::CBoxCollider*>(pCollComp->GetCollider())->SetSize(math::CVector3(100.0f, 0.0f, 100.0f));
+  pCollComp->GetCollider()->SetStatic(true);
 
   // Create primitives
   const uint32_t uSize = 3;
@@ -173,7 +176,6 @@ int main()
   const float fDayNightCycleSpeed = 50.0f;
   math::CVector3 v3DayNightCycle = math::CVector3(0.0f, 0.0f, 0.0f);
 
-  float fFixedDeltaAcc = 0.0f;
   MSG oMsg = { 0 };
 
   while (WM_QUIT != oMsg.message)
@@ -188,14 +190,13 @@ int main()
       // Push begin draw
       pEngine->PrepareFrame();
 
-      // Calculate delta
+      // Calculate delta + fixed ticks
       pTimeManager->BeginFrame();
-      float fFixedDelta = pTimeManager->GetFixedDelta();
-      float fOffset = math::Clamp(pTimeManager->GetDeltaTime(), 0.0f, pTimeManager->GetMaxFixedDelta());
-      fFixedDeltaAcc += fOffset;
+      const float fFixedDelta = pTimeManager->GetFixedDelta();
+      const float fSubstepDelta = pTimeManager->GetSubstepDelta();
 
       // Update
-      while (fFixedDeltaAcc >= fFixedDelta)
+      for (uint32_t uTick = 0; uTick < pTimeManager->GetFixedTicks(); ++uTick)
       {
         if (bDayNightCycle)
         {
@@ -208,14 +209,21 @@ int main()
         pCamera->Update(fFixedDelta);
         pCamera->DrawDebug();
 
-        pPhysicsManager->Update(fFixedDelta);
-        pCollisionManager->Update(fFixedDelta);
+        pGameManager->BeginFixedTick();
+        for (uint32_t uSubstep = 0; uSubstep < pTimeManager->GetSubsteps(); ++uSubstep)
+        {
+          pPhysicsManager->Update(fSubstepDelta);
+          pGameManager->ApplyMotions(pPhysicsManager->GetMotions());
+          pCollisionManager->Update(fSubstepDelta);
+        }
         pGameManager->Update(fFixedDelta);
 
         pInputManager->Flush();
-        fFixedDeltaAcc -= fFixedDelta;
       }
 
+      // Render poses between the last two fixed ticks
+      pGameManager->InterpolateRender(pTimeManager->GetInterpolationAlpha());
+
       ImGui::Begin("Testing");
       if (ImGui::Button("Enabled Raycast"))
       {
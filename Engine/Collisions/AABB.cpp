@@ -26,10 +26,56 @@ namespace collision
     pEngine->DrawCube(GetCenter(), math::CVector3::Zero, GetSize(), _v3Color, render::ERenderMode::WIREFRAME);
   }
 #endif
+  // ------------------------------------
+  bool IntersectRay(const CAABB& _rAABB, const physics::CRay& _oRay, float _fMaxDistance)
+  {
+    const math::CVector3& v3Origin = _oRay.GetOrigin();
+    const math::CVector3& v3Dir = _oRay.GetDir();
+
+    float fMinValue = 0.0f;
+    float fMaxValue = _fMaxDistance;
+
+    // Standard slab algorithm
+    for (uint32_t uAxis = 0; uAxis < 3; ++uAxis)
+    {
+      float fMin = _rAABB.GetMin()[uAxis];
+      float fMax = _rAABB.GetMax()[uAxis];
+      if (fabs(v3Dir[uAxis]) < math::s_fEpsilon6)
+      {
+        // Check parallel ray
+        if (v3Origin[uAxis] < fMin || v3Origin[uAxis] > fMax)
+        {
+          return false;
+        }
+        continue;
+      }
+
+      float fInvDir = 1.0f / v3Dir[uAxis];
+      float t1 = (fMin - v3Origin[uAxis]) * fInvDir;
+      float t2 = (fMax - v3Origin[uAxis]) * fInvDir;
+      if (t1 > t2)
+      {
+        std::swap(t1, t2);
+      }
+
+      fMinValue = math::Max(fMinValue, t1);
+      fMaxValue = math::Min(fMaxValue, t2);
+      if (fMinValue > fMaxValue)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
   // ------------------------------------
   void ComputeLocalAABB(const std::vector<math::CVector3>& _lstVertices, CAABB& _rLocalAABB_)
   {
-    if (_lstVertices.empty())
+    ComputeLocalAABB(_lstVertices.data(), _lstVertices.size(), _rLocalAABB_);
+  }
+  // ------------------------------------
+  void ComputeLocalAABB(const math::CVector3* _pVertices, size_t _tVertexCount, CAABB& _rLocalAABB_)
+  {
+    if (_tVertexCount == 0)
     {
       return;
     }
@@ -38,8 +84,9 @@ namespace collision
     math::CVector3 v3Min(FLT_MAX, FLT_MAX, FLT_MAX);
     math::CVector3 v3Max(-FLT_MAX, -FLT_MAX, -FLT_MAX);
 
-    for (const math::CVector3& Vertex : _lstVertices)
+    for (size_t tIndex = 0; tIndex < _tVertexCount; ++tIndex)
     {
+      const math::CVector3& Vertex = _pVertices[tIndex];
       // Calculate Min
       v3Min.x = math::Min(v3Min.x, Vertex.x);
       v3Min.y = math::Min(v3Min.y, Vertex.y);
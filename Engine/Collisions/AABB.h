@@ -1,8 +1,8 @@
 #pragma once
-#include "Collider.h"
 #include "Libs/Math/Math.h"
 #include "Libs/Math/Vector3.h"
 #include "Libs/Math/Transform.h"
+#include <vector>
 
 namespace render { namespace gfx { struct TVertexData; } }
 
@@ -35,7 +35,15 @@ namespace collision
   };
 
   // AABB
+  inline bool CheckOverlap(const collision::CAABB& _rAABB, const collision::CAABB& _rOther)
+  {
+    return (_rAABB.GetMin().x <= _rOther.GetMax().x && _rAABB.GetMax().x >= _rOther.GetMin().x) &&
+      (_rAABB.GetMin().y <= _rOther.GetMax().y && _rAABB.GetMax().y >= _rOther.GetMin().y) &&
+      (_rAABB.GetMin().z <= _rOther.GetMax().z && _rAABB.GetMax().z >= _rOther.GetMin().z);
+  }
+  bool IntersectRay(const collision::CAABB& _rAABB, const physics::CRay& _oRay, float _fMaxDistance);
   void ComputeLocalAABB(const std::vector<math::CVector3>& _lstVertices, collision::CAABB& _rLocalAABB_);
+  void ComputeLocalAABB(const math::CVector3* _pVertices, size_t _tVertexCount, collision::CAABB& _rLocalAABB_);
   void ComputeLocalAABB(const std::vector<render::gfx::TVertexData>& _lstVertexData, collision::CAABB& _rLocalAABB_);
   void ComputeWorldAABB(const collision::CAABB& _rLocalAABB, const math::CTransform& _rTransform, collision::CAABB& _rWorldAABB_);
 }
@@ -5,12 +5,65 @@
 #include "Libs/Math/Math.h"
 #include <cassert>
 #include "Libs/Math/Vector3.h"
+#include <xmmintrin.h>
 
 namespace collision
 {
   namespace internal_box_collider
   {
     static const float s_fDebugRadius = 0.01f;
+    static constexpr uint32_t s_uSATAxisCount = 15u;
+
+    // Extents as structure of arrays (two SSE registers per component)
+    struct TExtentLanes
+    {
+      alignas(16) float X[CBoxCollider::s_uExtentCount];
+      alignas(16) float Y[CBoxCollider::s_uExtentCount];
+      alignas(16) float Z[CBoxCollider::s_uExtentCount];
+    };
+
+    inline void FillExtentLanes(const CBoxCollider::TExtents& _rExtents, TExtentLanes& _rLanes_)
+    {
+      for (uint32_t uIndex = 0; uIndex < CBoxCollider::s_uExtentCount; ++uIndex)
+      {
+        _rLanes_.X[uIndex] = _rExtents[uIndex].x;
+        _rLanes_.Y[uIndex] = _rExtents[uIndex].y;
+        _rLanes_.Z[uIndex] = _rExtents[uIndex].z;
+      }
+    }
+
+    inline math::TAxisProjection ProjectExtents(const TExtentLanes& _rLanes, const CBoxCollider::TExtents& _rExtents, const math::CVector3& _v3Axis)
+    {
+      // Dot products of the 8 extents
+      __m128 vAxisX = _mm_set1_ps(_v3Axis.x);
+      __m128 vAxisY = _mm_set1_ps(_v3Axis.y);
+      __m128 vAxisZ = _mm_set1_ps(_v3Axis.z);
+      __m128 vDotLow = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_load_ps(&_rLanes.X[0]), vAxisX), _mm_mul_ps(_mm_load_ps(&_rLanes.Y[0]), vAxisY)), _mm_mul_ps(_mm_load_ps(&_rLanes.Z[0]), vAxisZ));
+      __m128 vDotHigh = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_load_ps(&_rLanes.X[4]), vAxisX), _mm_mul_ps(_mm_load_ps(&_rLanes.Y[4]), vAxisY)), _mm_mul_ps(_mm_load_ps(&_rLanes.Z[4]), vAxisZ));
+
+      // Horizontal min-max
+      __m128 vMin = _mm_min_ps(vDotLow, vDotHigh);
+      __m128 vMax = _mm_max_ps(vDotLow, vDotHigh);
+      vMin = _mm_min_ps(vMin, _mm_shuffle_ps(vMin, vMin, _MM_SHUFFLE(2, 3, 0, 1)));
+      vMax = _mm_max_ps(vMax, _mm_shuffle_ps(vMax, vMax, _MM_SHUFFLE(2, 3, 0, 1)));
+      vMin = _mm_min_ps(vMin, _mm_shuffle_ps(vMin, vMin, _MM_SHUFFLE(1, 0, 3, 2)));
+      vMax = _mm_max_ps(vMax, _mm_shuffle_ps(vMax, vMax, _MM_SHUFFLE(1, 0, 3, 2)));
+
+      // First extent with the min projection (same as math::ProjectPoints)
+      uint32_t uMinMask = static_cast<uint32_t>(_mm_movemask_ps(_mm_cmpeq_ps(vDotLow, vMin))) |
+        (static_cast<uint32_t>(_mm_movemask_ps(_mm_cmpeq_ps(vDotHigh, vMin))) << 4);
+      uint32_t uMinIdx = 0;
+      while (uMinIdx < CBoxCollider::s_uExtentCount - 1 && (uMinMask & (1u << uMinIdx)) == 0)
+      {
+        ++uMinIdx;
+      }
+
+      math::TAxisProjection oProjection;
+      oProjection.Min = _mm_cvtss_f32(vMin);
+      oProjection.Max = _mm_cvtss_f32(vMax);
+      oProjection.MinPoint = _rExtents[uMinIdx];
+      return oProjection;
+    }
   }
   // ------------------------------------
   CBoxCollider::CBoxCollider(void* _pOwner) : CCollider(collision::EColliderType::BOX_COLLIDER, _pOwner),
@@ -18,11 +71,11 @@ namespace collision
   {
     ComputeMinMax();
     ComputeExtents();
+    ComputeBoundingBox();
   }
   // ------------------------------------
   CBoxCollider::~CBoxCollider()
   {
-    m_v3Extents.clear();
   }
   // ------------------------------------
   bool CBoxCollider::CheckCollision(const CCollider& _oCollider, THitEvent& _oHitEvent_)
@@ -59,7 +112,7 @@ namespace collision
     const math::CVector3& v3RayDir = _oRay.GetDir();
     math::CVector3 v3Delta = v3RayOrigin - GetPos();
 
-    const std::vector<math::CVector3> lstAxis = GetAxisDirectors();
+    const TAxisDirectors lstAxis = GetAxisDirectors();
     math::CVector3 v3HalfSize = (m_v3Max - m_v3Min) * 0.5f;
 
     float fMinValue = -FLT_MAX;
@@ -130,19 +183,16 @@ namespace collision
   {
     ComputeMinMax();
     ComputeExtents();
-  }
-  // ------------------------------------
-  std::vector<math::CVector3> CBoxCollider::GetAxisDirectors() const
-  {
-    return std::vector<math::CVector3> { m_v3Right, m_v3Up, m_v3Forward };
+    ComputeBoundingBox();
   }
   // ------------------------------------
   bool CBoxCollider::CheckOBBCollision(const CBoxCollider* _pOther, THitEvent& _oHitEvent_) const
   {
-    const std::vector<math::CVector3>& v3Extents = this->GetExtents();
-    const std::vector<math::CVector3>& v3OtherExtents = _pOther->GetExtents();
+    internal_box_collider::TExtentLanes oLanes, oOtherLanes;
+    internal_box_collider::FillExtentLanes(m_v3Extents, oLanes);
+    internal_box_collider::FillExtentLanes(_pOther->m_v3Extents, oOtherLanes);
 
-    std::vector<math::CVector3> lstAxis =
+    const std::array<math::CVector3, internal_box_collider::s_uSATAxisCount> lstAxis =
     {
       // Normals 
       this->m_v3Right,
@@ -172,7 +222,14 @@ namespace collision
 
     for (const math::CVector3& v3Axis : lstAxis)
     {
-      if (math::SeparateAxisTheorem(v3Extents, v3OtherExtents, v3Axis, v3ImpactPoint, v3Normal, fDepth))
+      if (v3Axis.IsZero())
+      {
+        continue;
+      }
+
+      math::TAxisProjection oProjection = internal_box_collider::ProjectExtents(oLanes, m_v3Extents, v3Axis);
+      math::TAxisProjection oOtherProjection = internal_box_collider::ProjectExtents(oOtherLanes, _pOther->m_v3Extents, v3Axis);
+      if (math::SeparateAxisTheorem(oProjection, oOtherProjection, v3Axis, v3ImpactPoint, v3Normal, fDepth))
       {
         return false;
       }
@@ -241,7 +298,7 @@ namespace collision
     // Get OBB data
     const math::CVector3& v3OBBCenter = GetCenter();
     const math::CVector3 v3HalfSize = GetHalfSize();
-    const std::vector<math::CVector3> v3Axis = GetAxisDirectors();
+    const TAxisDirectors v3Axis = GetAxisDirectors();
 
     // Calculate dir
     const math::CVector3& v3SphereCenter = _pOther->GetCenter();
@@ -312,17 +369,14 @@ namespace collision
 
     // Calculate extents
     const math::CVector3& v3Center = GetCenter();
-    m_v3Extents =
-    {
-      v3Center + mRot * (m_v3Min - v3Center),
-      v3Center + mRot * (math::CVector3(m_v3Min.x, m_v3Min.y, m_v3Max.z) - v3Center),
-      v3Center + mRot * (math::CVector3(m_v3Min.x, m_v3Max.y, m_v3Min.z) - v3Center),
-      v3Center + mRot * (math::CVector3(m_v3Min.x, m_v3Max.y, m_v3Max.z) - v3Center),
-      v3Center + mRot * (math::CVector3(m_v3Max.x, m_v3Min.y, m_v3Min.z) - v3Center),
-      v3Center + mRot * (math::CVector3(m_v3Max.x, m_v3Min.y, m_v3Max.z) - v3Center),
-      v3Center + mRot * (math::CVector3(m_v3Max.x, m_v3Max.y, m_v3Min.z) - v3Center),
-      v3Center + mRot * (m_v3Max - v3Center)
-    };
+    m_v3Extents[0] = v3Center + mRot * (m_v3Min - v3Center);
+    m_v3Extents[1] = v3Center + mRot * (math::CVector3(m_v3Min.x, m_v3Min.y, m_v3Max.z) - v3Center);
+    m_v3Extents[2] = v3Center + mRot * (math::CVector3(m_v3Min.x, m_v3Max.y, m_v3Min.z) - v3Center);
+    m_v3Extents[3] = v3Center + mRot * (math::CVector3(m_v3Min.x, m_v3Max.y, m_v3Max.z) - v3Center);
+    m_v3Extents[4] = v3Center + mRot * (math::CVector3(m_v3Max.x, m_v3Min.y, m_v3Min.z) - v3Center);
+    m_v3Extents[5] = v3Center + mRot * (math::CVector3(m_v3Max.x, m_v3Min.y, m_v3Max.z) - v3Center);
+    m_v3Extents[6] = v3Center + mRot * (math::CVector3(m_v3Max.x, m_v3Max.y, m_v3Min.z) - v3Center);
+    m_v3Extents[7] = v3Center + mRot * (m_v3Max - v3Center);
 
     // Set dir vectors
     m_v3Forward = mRot * math::CVector3::Forward;
@@ -337,6 +391,29 @@ namespace collision
     m_v3Max = GetPos() + v3HalfSize;
   }
   // ------------------------------------
+  void CBoxCollider::ComputeBoundingBox()
+  {
+    // Merge min-max with the rotated extents, so the bounds are valid in both AABB and OBB mode
+    math::CVector3 v3Min = m_v3Min;
+    math::CVector3 v3Max = m_v3Max;
+
+    for (const math::CVector3& v3Extent : m_v3Extents)
+    {
+      // Calculate Min
+      v3Min.x = math::Min(v3Min.x, v3Extent.x);
+      v3Min.y = math::Min(v3Min.y, v3Extent.y);
+      v3Min.z = math::Min(v3Min.z, v3Extent.z);
+
+      // Calculate Max
+      v3Max.x = math::Max(v3Max.x, v3Extent.x);
+      v3Max.y = math::Max(v3Max.y, v3Extent.y);
+      v3Max.z = math::Max(v3Max.z, v3Extent.z);
+    }
+
+    m_oBoundingBox.SetMin(v3Min);
+    m_oBoundingBox.SetMax(v3Max);
+  }
+  // ------------------------------------
 #ifdef _DEBUG
   void CBoxCollider::DrawDebug()
   {
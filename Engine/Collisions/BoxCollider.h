@@ -1,6 +1,7 @@
 #pragma once
 #include "Collider.h"
 #include "Libs/Math/Vector3.h"
+#include <array>
 
 namespace collision { class CSphereCollider; }
 
@@ -8,6 +9,14 @@ namespace collision
 {
   class CBoxCollider final : public CCollider
   {
+  public:
+    friend class CNarrowPhase;
+
+    static constexpr uint32_t s_uExtentCount = 8u;
+    static constexpr uint32_t s_uAxisCount = 3u;
+    typedef std::array<math::CVector3, s_uExtentCount> TExtents;
+    typedef std::array<math::CVector3, s_uAxisCount> TAxisDirectors;
+
   public:
     CBoxCollider(void* _pOwner);
     ~CBoxCollider();
@@ -29,8 +38,8 @@ namespace collision
     inline const math::CVector3& GetMax() const { return m_v3Max; }
     inline const math::CVector3& GetMin() const { return m_v3Min; }
 
-    inline const std::vector<math::CVector3>& GetExtents() const { return m_v3Extents; }
-    std::vector<math::CVector3> GetAxisDirectors() const;
+    inline const TExtents& GetExtents() const { return m_v3Extents; }
+    inline TAxisDirectors GetAxisDirectors() const { return TAxisDirectors { m_v3Right, m_v3Up, m_v3Forward }; }
 
     inline const math::CVector3& GetRightAxis() const { return m_v3Right; }
     inline const math::CVector3& GetUpAxis() const { return m_v3Up; }
@@ -49,6 +58,7 @@ namespace collision
 
     void ComputeExtents();
     void ComputeMinMax();
+    void ComputeBoundingBox();
 
   private:
     // Size
@@ -65,7 +75,7 @@ namespace collision
     bool m_bOBB;
 
     // Extents
-    std::vector<math::CVector3> m_v3Extents;
+    TExtents m_v3Extents = TExtents();
   };
 }
 
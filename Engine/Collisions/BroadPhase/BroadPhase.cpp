@@ -0,0 +1,15 @@
+#include "BroadPhase.h"
+#include <algorithm>
+
+namespace collision
+{
+  // ------------------------------------
+  void CBroadPhase::SortPairs(TPairList& _lstPairs_)
+  {
+    // Creation order (collider id A, then collider id B)
+    std::sort(_lstPairs_.begin(), _lstPairs_.end(), [](const collision::TCollisionPair& _rA, const collision::TCollisionPair& _rB)
+    {
+      return _rA.Key < _rB.Key;
+    });
+  }
+}
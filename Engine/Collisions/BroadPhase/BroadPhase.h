@@ -0,0 +1,71 @@
+#pragma once
+#include "Engine/Collisions/AABB.h"
+#include "Engine/Utils/Ray.h"
+#include <vector>
+
+namespace collision { class CCollider; }
+
+namespace collision
+{
+  enum class EBroadPhaseType
+  {
+    SWEEP_AND_PRUNE,
+    DYNAMIC_TREE
+  };
+
+  struct TCollisionPair
+  {
+    uint64_t Key = 0; // Collider id A (high) + collider id B (low)
+    collision::CCollider* ColliderA = nullptr;
+    collision::CCollider* ColliderB = nullptr;
+  };
+
+  inline uint64_t MakePairKey(uint32_t _uColliderIDA, uint32_t _uColliderIDB)
+  {
+    return (static_cast<uint64_t>(_uColliderIDA) << 32) | static_cast<uint64_t>(_uColliderIDB);
+  }
+
+  // Static pairs and pairs filtered by the layer matrix never reach the narrow-phase
+  inline bool CheckPairFilter(bool _bStaticA, uint32_t _uLayerFilterA, bool _bStaticB, uint32_t _uLayersB)
+  {
+    return !(_bStaticA && _bStaticB) && (_uLayerFilterA & _uLayersB) != 0;
+  }
+
+  class CBroadPhase
+  {
+  public:
+    typedef std::vector<collision::TCollisionPair> TPairList;
+    typedef std::vector<collision::CCollider*> TColliderList;
+
+  public:
+    CBroadPhase(EBroadPhaseType _eBroadPhaseType) : m_eBroadPhaseType(_eBroadPhaseType) {}
+    virtual ~CBroadPhase() {}
+
+    // Bounds are pushed by the owner, the broad-phase never reads them from the colliders
+    virtual uint32_t CreateProxy(collision::CCollider* _pCollider, const collision::CAABB& _oAABB) = 0;
+    virtual void DestroyProxy(uint32_t _uProxyID) = 0;
+    virtual void MoveProxy(uint32_t _uProxyID, const collision::CAABB& _oAABB) = 0;
+    // Static proxies never pair with each other
+    virtual void SetProxyStatic(uint32_t _uProxyID, bool _bStatic) = 0;
+    // Layers of the proxy + layers it can collide with
+    virtual void SetProxyLayers(uint32_t _uProxyID, uint32_t _uLayers, uint32_t _uLayerFilter) = 0;
+
+    // Collect the overlapping pairs (sorted by key)
+    virtual void UpdatePairs(TPairList& _lstPairs_) = 0;
+
+    // Queries (bounds only, the narrow-phase is up to the caller)
+    virtual void QueryRay(const physics::CRay& _oRay, float _fMaxDistance, TColliderList& _lstColliders_) = 0;
+    virtual void QueryAABB(const collision::CAABB& _oAABB, TColliderList& _lstColliders_) = 0;
+
+    // Whole state of a broad-phase of the same type (snapshots)
+    virtual void CopyFrom(const CBroadPhase& _rOther) = 0;
+
+    inline const EBroadPhaseType& GetType() const { return m_eBroadPhaseType; }
+
+  protected:
+    static void SortPairs(TPairList& _lstPairs_);
+
+  private:
+    EBroadPhaseType m_eBroadPhaseType = EBroadPhaseType::SWEEP_AND_PRUNE;
+  };
+}
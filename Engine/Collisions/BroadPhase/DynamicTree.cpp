@@ -0,0 +1,476 @@
+#include "DynamicTree.h"
+#include "Engine/Collisions/Collider.h"
+#include <cassert>
+
+namespace collision
+{
+  namespace internal_dynamic_tree
+  {
+    inline collision::CAABB Combine(const collision::CAABB& _rA, const collision::CAABB& _rB)
+    {
+      math::CVector3 v3Min(math::Min(_rA.GetMin().x, _rB.GetMin().x), math::Min(_rA.GetMin().y, _rB.GetMin().y), math::Min(_rA.GetMin().z, _rB.GetMin().z));
+      math::CVector3 v3Max(math::Max(_rA.GetMax().x, _rB.GetMax().x), math::Max(_rA.GetMax().y, _rB.GetMax().y), math::Max(_rA.GetMax().z, _rB.GetMax().z));
+      return collision::CAABB(v3Min, v3Max);
+    }
+
+    inline float GetSurfaceArea(const collision::CAABB& _rAABB)
+    {
+      math::CVector3 v3Size = _rAABB.GetSize();
+      return 2.0f * ((v3Size.x * v3Size.y) + (v3Size.y * v3Size.z) + (v3Size.z * v3Size.x));
+    }
+
+    inline bool Contains(const collision::CAABB& _rOuter, const collision::CAABB& _rInner)
+    {
+      return _rOuter.GetMin().x <= _rInner.GetMin().x && _rOuter.GetMin().y <= _rInner.GetMin().y && _rOuter.GetMin().z <= _rInner.GetMin().z &&
+        _rInner.GetMax().x <= _rOuter.GetMax().x && _rInner.GetMax().y <= _rOuter.GetMax().y && _rInner.GetMax().z <= _rOuter.GetMax().z;
+    }
+
+    inline collision::CAABB Fatten(const collision::CAABB& _rAABB)
+    {
+      const float& fMargin = CDynamicTree::s_fAABBMargin;
+      math::CVector3 v3Margin(fMargin, fMargin, fMargin);
+      return collision::CAABB(_rAABB.GetMin() - v3Margin, _rAABB.GetMax() + v3Margin);
+    }
+  }
+  // ------------------------------------
+  uint32_t CDynamicTree::CreateProxy(collision::CCollider* _pCollider, const collision::CAABB& _oAABB)
+  {
+#ifdef _DEBUG
+    assert(_pCollider);
+#endif
+    int32_t iLeaf = AllocateNode();
+    TTreeNode& rLeaf = m_lstNodes[iLeaf];
+    rLeaf.AABB = internal_dynamic_tree::Fatten(_oAABB);
+    rLeaf.ProxyAABB = _oAABB;
+    rLeaf.Collider = _pCollider;
+    rLeaf.ColliderID = _pCollider->GetID();
+    rLeaf.Layers = 0xFFFFFFFFu;
+    rLeaf.LayerFilter = 0xFFFFFFFFu;
+    rLeaf.Static = false;
+    rLeaf.Height = 0;
+
+    InsertLeaf(iLeaf);
+    m_tProxyCount++;
+    return static_cast<uint32_t>(iLeaf);
+  }
+  // ------------------------------------
+  void CDynamicTree::DestroyProxy(uint32_t _uProxyID)
+  {
+    int32_t iLeaf = static_cast<int32_t>(_uProxyID);
+    if (iLeaf < 0 || iLeaf >= static_cast<int32_t>(m_lstNodes.size()) || !m_lstNodes[iLeaf].Collider)
+    {
+      return;
+    }
+
+    RemoveLeaf(iLeaf);
+    FreeNode(iLeaf);
+    m_tProxyCount--;
+  }
+  // ------------------------------------
+  void CDynamicTree::MoveProxy(uint32_t _uProxyID, const collision::CAABB& _oAABB)
+  {
+    int32_t iLeaf = static_cast<int32_t>(_uProxyID);
+#ifdef _DEBUG
+    assert(iLeaf >= 0 && iLeaf < static_cast<int32_t>(m_lstNodes.size()) && m_lstNodes[iLeaf].Collider);
+#endif
+    m_lstNodes[iLeaf].ProxyAABB = _oAABB;
+    if (internal_dynamic_tree::Contains(m_lstNodes[iLeaf].AABB, _oAABB))
+    {
+      return;
+    }
+
+    RemoveLeaf(iLeaf);
+    m_lstNodes[iLeaf].AABB = internal_dynamic_tree::Fatten(_oAABB);
+    InsertLeaf(iLeaf);
+  }
+  // ------------------------------------
+  void CDynamicTree::SetProxyStatic(uint32_t _uProxyID, bool _bStatic)
+  {
+    int32_t iLeaf = static_cast<int32_t>(_uProxyID);
+#ifdef _DEBUG
+    assert(iLeaf >= 0 && iLeaf < static_cast<int32_t>(m_lstNodes.size()) && m_lstNodes[iLeaf].Collider);
+#endif
+    m_lstNodes[iLeaf].Static = _bStatic;
+  }
+  // ------------------------------------
+  void CDynamicTree::SetProxyLayers(uint32_t _uProxyID, uint32_t _uLayers, uint32_t _uLayerFilter)
+  {
+    int32_t iLeaf = static_cast<int32_t>(_uProxyID);
+#ifdef _DEBUG
+    assert(iLeaf >= 0 && iLeaf < static_cast<int32_t>(m_lstNodes.size()) && m_lstNodes[iLeaf].Collider);
+#endif
+    m_lstNodes[iLeaf].Layers = _uLayers;
+    m_lstNodes[iLeaf].LayerFilter = _uLayerFilter;
+  }
+  // ------------------------------------
+  void CDynamicTree::UpdatePairs(TPairList& _lstPairs_)
+  {
+    _lstPairs_.clear();
+
+    // Query every non static leaf against the tree (static and sleeping leaves never query)
+    for (int32_t iNode = 0; iNode < static_cast<int32_t>(m_lstNodes.size()); ++iNode)
+    {
+      const TTreeNode& rLeaf = m_lstNodes[iNode];
+      if (!rLeaf.Collider || rLeaf.Static)
+      {
+        continue;
+      }
+
+      Query(rLeaf.ProxyAABB, [&](const TTreeNode& _rOther)
+      {
+        // Pairs between non static leaves are found twice, keep the one in creation order
+        bool bFiltered = !collision::CheckPairFilter(rLeaf.Static, rLeaf.LayerFilter, _rOther.Static, _rOther.Layers);
+        bool bOwner = _rOther.Static || rLeaf.ColliderID < _rOther.ColliderID;
+        if (bOwner && !bFiltered && collision::CheckOverlap(rLeaf.ProxyAABB, _rOther.ProxyAABB))
+        {
+          // Same order as the collider IDs
+          const TTreeNode& rFirst = rLeaf.ColliderID < _rOther.ColliderID ? rLeaf : _rOther;
+          const TTreeNode& rSecond = rLeaf.ColliderID < _rOther.ColliderID ? _rOther : rLeaf;
+          collision::TCollisionPair& rPair = _lstPairs_.emplace_back();
+          rPair.Key = collision::MakePairKey(rFirst.ColliderID, rSecond.ColliderID);
+          rPair.ColliderA = rFirst.Collider;
+          rPair.ColliderB = rSecond.Collider;
+        }
+      });
+    }
+
+    // Deterministic order
+    SortPairs(_lstPairs_);
+  }
+  // ------------------------------------
+  void CDynamicTree::QueryRay(const physics::CRay& _oRay, float _fMaxDistance, TColliderList& _lstColliders_)
+  {
+    _lstColliders_.clear();
+    if (m_iRoot == s_iNullNode)
+    {
+      return;
+    }
+
+    m_lstStack.clear();
+    m_lstStack.emplace_back(m_iRoot);
+    while (!m_lstStack.empty())
+    {
+      const TTreeNode& rNode = m_lstNodes[m_lstStack.back()];
+      m_lstStack.pop_back();
+
+      if (!collision::IntersectRay(rNode.AABB, _oRay, _fMaxDistance))
+      {
+        continue;
+      }
+
+      if (rNode.IsLeaf())
+      {
+        // Fat bounds are only a hint, test the real ones
+        if (collision::IntersectRay(rNode.ProxyAABB, _oRay, _fMaxDistance))
+        {
+          _lstColliders_.emplace_back(rNode.Collider);
+        }
+        continue;
+      }
+
+      m_lstStack.emplace_back(rNode.Left);
+      m_lstStack.emplace_back(rNode.Right);
+    }
+  }
+  // ------------------------------------
+  void CDynamicTree::QueryAABB(const collision::CAABB& _oAABB, TColliderList& _lstColliders_)
+  {
+    _lstColliders_.clear();
+    Query(_oAABB, [&](const TTreeNode& _rLeaf)
+    {
+      if (collision::CheckOverlap(_oAABB, _rLeaf.ProxyAABB))
+      {
+        _lstColliders_.emplace_back(_rLeaf.Collider);
+      }
+    });
+  }
+  // ------------------------------------
+  void CDynamicTree::CopyFrom(const CBroadPhase& _rOther)
+  {
+#ifdef _DEBUG
+    assert(_rOther.GetType() == GetType());
+#endif
+    // Node indices are the proxy ids, the tree keeps its exact shape
+    *this = static_cast<const CDynamicTree&>(_rOther);
+  }
+  // ------------------------------------
+  template<typename TVisitor>
+  void CDynamicTree::Query(const collision::CAABB& _oAABB, TVisitor&& _oVisitor)
+  {
+    if (m_iRoot == s_iNullNode)
+    {
+      return;
+    }
+
+    m_lstStack.clear();
+    m_lstStack.emplace_back(m_iRoot);
+    while (!m_lstStack.empty())
+    {
+      const TTreeNode& rNode = m_lstNodes[m_lstStack.back()];
+      m_lstStack.pop_back();
+
+      if (!collision::CheckOverlap(rNode.AABB, _oAABB))
+      {
+        continue;
+      }
+
+      if (rNode.IsLeaf())
+      {
+        _oVisitor(rNode);
+        continue;
+      }
+
+      m_lstStack.emplace_back(rNode.Left);
+      m_lstStack.emplace_back(rNode.Right);
+    }
+  }
+  // ------------------------------------
+  int32_t CDynamicTree::AllocateNode()
+  {
+    if (m_iFreeList == s_iNullNode)
+    {
+      m_lstNodes.emplace_back();
+      return static_cast<int32_t>(m_lstNodes.size() - 1);
+    }
+
+    int32_t iNode = m_iFreeList;
+    m_iFreeList = m_lstNodes[iNode].Parent;
+    m_lstNodes[iNode] = TTreeNode();
+    return iNode;
+  }
+  // ------------------------------------
+  void CDynamicTree::FreeNode(int32_t _iNode)
+  {
+    TTreeNode& rNode = m_lstNodes[_iNode];
+    rNode = TTreeNode();
+    rNode.Parent = m_iFreeList;
+    m_iFreeList = _iNode;
+  }
+  // ------------------------------------
+  void CDynamicTree::InsertLeaf(int32_t _iLeaf)
+  {
+    if (m_iRoot == s_iNullNode)
+    {
+      m_iRoot = _iLeaf;
+      m_lstNodes[m_iRoot].Parent = s_iNullNode;
+      return;
+    }
+
+    // Find the best sibling (surface area heuristic)
+    collision::CAABB oLeafAABB = m_lstNodes[_iLeaf].AABB;
+    int32_t iIndex = m_iRoot;
+    while (!m_lstNodes[iIndex].IsLeaf())
+    {
+      const TTreeNode& rNode = m_lstNodes[iIndex];
+      float fArea = internal_dynamic_tree::GetSurfaceArea(rNode.AABB);
+      float fCombinedArea = internal_dynamic_tree::GetSurfaceArea(internal_dynamic_tree::Combine(rNode.AABB, oLeafAABB));
+
+      // Cost of creating a new parent for this node and the new leaf
+      float fCost = 2.0f * fCombinedArea;
+      // Minimum cost of pushing the leaf further down the tree
+      float fInheritanceCost = 2.0f * (fCombinedArea - fArea);
+
+      auto ComputeChildCost = [&](int32_t _iChild)
+      {
+        const TTreeNode& rChild = m_lstNodes[_iChild];
+        float fChildCost = internal_dynamic_tree::GetSurfaceArea(internal_dynamic_tree::Combine(rChild.AABB, oLeafAABB));
+        if (!rChild.IsLeaf())
+        {
+          fChildCost -= internal_dynamic_tree::GetSurfaceArea(rChild.AABB);
+        }
+        return fChildCost + fInheritanceCost;
+      };
+
+      float fCostLeft = ComputeChildCost(rNode.Left);
+      float fCostRight = ComputeChildCost(rNode.Right);
+      if (fCost < fCostLeft && fCost < fCostRight)
+      {
+        break;
+      }
+      iIndex = fCostLeft < fCostRight ? rNode.Left : rNode.Right;
+    }
+
+    // Create a new parent
+    int32_t iSibling = iIndex;
+    int32_t iOldParent = m_lstNodes[iSibling].Parent;
+    int32_t iNewParent = AllocateNode();
+
+    TTreeNode& rNewParent = m_lstNodes[iNewParent];
+    rNewParent.Parent = iOldParent;
+    rNewParent.AABB = internal_dynamic_tree::Combine(oLeafAABB, m_lstNodes[iSibling].AABB);
+    rNewParent.Height = m_lstNodes[iSibling].Height + 1;
+    rNewParent.Left = iSibling;
+    rNewParent.Right = _iLeaf;
+
+    if (iOldParent != s_iNullNode)
+    {
+      TTreeNode& rOldParent = m_lstNodes[iOldParent];
+      (rOldParent.Left == iSibling ? rOldParent.Left : rOldParent.Right) = iNewParent;
+    }
+    else
+    {
+      m_iRoot = iNewParent;
+    }
+    m_lstNodes[iSibling].Parent = iNewParent;
+    m_lstNodes[_iLeaf].Parent = iNewParent;
+
+    // Walk back up fixing heights and bounds
+    Refit(m_lstNodes[_iLeaf].Parent);
+  }
+  // ------------------------------------
+  void CDynamicTree::RemoveLeaf(int32_t _iLeaf)
+  {
+    if (_iLeaf == m_iRoot)
+    {
+      m_iRoot = s_iNullNode;
+      return;
+    }
+
+    int32_t iParent = m_lstNodes[_iLeaf].Parent;
+    int32_t iGrandParent = m_lstNodes[iParent].Parent;
+    int32_t iSibling = m_lstNodes[iParent].Left == _iLeaf ? m_lstNodes[iParent].Right : m_lstNodes[iParent].Left;
+
+    if (iGrandParent != s_iNullNode)
+    {
+      // Destroy parent and connect sibling to grand parent
+      TTreeNode& rGrandParent = m_lstNodes[iGrandParent];
+      (rGrandParent.Left == iParent ? rGrandParent.Left : rGrandParent.Right) = iSibling;
+      m_lstNodes[iSibling].Parent = iGrandParent;
+      FreeNode(iParent);
+
+      Refit(iGrandParent);
+    }
+    else
+    {
+      m_iRoot = iSibling;
+      m_lstNodes[iSibling].Parent = s_iNullNode;
+      FreeNode(iParent);
+    }
+    m_lstNodes[_iLeaf].Parent = s_iNullNode;
+  }
+  // ------------------------------------
+  void CDynamicTree::Refit(int32_t _iNode)
+  {
+    int32_t iIndex = _iNode;
+    while (iIndex != s_iNullNode)
+    {
+      iIndex = Balance(iIndex);
+
+      TTreeNode& rNode = m_lstNodes[iIndex];
+      const TTreeNode& rLeft = m_lstNodes[rNode.Left];
+      const TTreeNode& rRight = m_lstNodes[rNode.Right];
+      rNode.Height = 1 + math::Max(rLeft.Height, rRight.Height);
+      rNode.AABB = internal_dynamic_tree::Combine(rLeft.AABB, rRight.AABB);
+
+      iIndex = rNode.Parent;
+    }
+  }
+  // ------------------------------------
+  int32_t CDynamicTree::Balance(int32_t _iNode)
+  {
+    //       A
+    //     /   \
+    //    B     C
+    //   / \   / \
+    //  D   E F   G
+    int32_t iA = _iNode;
+    TTreeNode& rA = m_lstNodes[iA];
+    if (rA.IsLeaf() || rA.Height < 2)
+    {
+      return iA;
+    }
+
+    int32_t iB = rA.Left;
+    int32_t iC = rA.Right;
+    TTreeNode& rB = m_lstNodes[iB];
+    TTreeNode& rC = m_lstNodes[iC];
+
+    int32_t iBalance = rC.Height - rB.Height;
+
+    // Rotate C up
+    if (iBalance > 1)
+    {
+      int32_t iF = rC.Left;
+      int32_t iG = rC.Right;
+      TTreeNode& rF = m_lstNodes[iF];
+      TTreeNode& rG = m_lstNodes[iG];
+
+      // Swap A and C
+      rC.Left = iA;
+      rC.Parent = rA.Parent;
+      rA.Parent = iC;
+
+      // A's old parent should point to C
+      if (rC.Parent != s_iNullNode)
+      {
+        TTreeNode& rParent = m_lstNodes[rC.Parent];
+        (rParent.Left == iA ? rParent.Left : rParent.Right) = iC;
+      }
+      else
+      {
+        m_iRoot = iC;
+      }
+
+      // Keep the highest child under C
+      bool bKeepF = rF.Height > rG.Height;
+      int32_t iKeep = bKeepF ? iF : iG;
+      int32_t iMove = bKeepF ? iG : iF;
+      TTreeNode& rKeep = m_lstNodes[iKeep];
+      TTreeNode& rMove = m_lstNodes[iMove];
+
+      rC.Right = iKeep;
+      rA.Right = iMove;
+      rMove.Parent = iA;
+
+      rA.AABB = internal_dynamic_tree::Combine(rB.AABB, rMove.AABB);
+      rC.AABB = internal_dynamic_tree::Combine(rA.AABB, rKeep.AABB);
+      rA.Height = 1 + math::Max(rB.Height, rMove.Height);
+      rC.Height = 1 + math::Max(rA.Height, rKeep.Height);
+      return iC;
+    }
+
+    // Rotate B up
+    if (iBalance < -1)
+    {
+      int32_t iD = rB.Left;
+      int32_t iE = rB.Right;
+      TTreeNode& rD = m_lstNodes[iD];
+      TTreeNode& rE = m_lstNodes[iE];
+
+      // Swap A and B
+      rB.Left = iA;
+      rB.Parent = rA.Parent;
+      rA.Parent = iB;
+
+      // A's old parent should point to B
+      if (rB.Parent != s_iNullNode)
+      {
+        TTreeNode& rParent = m_lstNodes[rB.Parent];
+        (rParent.Left == iA ? rParent.Left : rParent.Right) = iB;
+      }
+      else
+      {
+        m_iRoot = iB;
+      }
+
+      // Keep the highest child under B
+      bool bKeepD = rD.Height > rE.Height;
+      int32_t iKeep = bKeepD ? iD : iE;
+      int32_t iMove = bKeepD ? iE : iD;
+      TTreeNode& rKeep = m_lstNodes[iKeep];
+      TTreeNode& rMove = m_lstNodes[iMove];
+
+      rB.Right = iKeep;
+      rA.Left = iMove;
+      rMove.Parent = iA;
+
+      rA.AABB = internal_dynamic_tree::Combine(rC.AABB, rMove.AABB);
+      rB.AABB = internal_dynamic_tree::Combine(rA.AABB, rKeep.AABB);
+      rA.Height = 1 + math::Max(rC.Height, rMove.Height);
+      rB.Height = 1 + math::Max(rA.Height, rKeep.Height);
+      return iB;
+    }
+
+    return iA;
+  }
+}
@@ -0,0 +1,74 @@
+#pragma once
+#include "BroadPhase.h"
+
+namespace collision
+{
+  // Dynamic bounding volume tree: leaves store fat bounds, so small displacements don't need a reinsert
+  class CDynamicTree final : public CBroadPhase
+  {
+  public:
+    static constexpr int32_t s_iNullNode = -1;
+    static constexpr float s_fAABBMargin = 0.1f;
+
+  public:
+    CDynamicTree() : CBroadPhase(EBroadPhaseType::DYNAMIC_TREE) {}
+    ~CDynamicTree() {}
+
+    virtual uint32_t CreateProxy(collision::CCollider* _pCollider, const collision::CAABB& _oAABB) override;
+    virtual void DestroyProxy(uint32_t _uProxyID) override;
+    // Only reinserts the proxy when it leaves its fat bounds
+    virtual void MoveProxy(uint32_t _uProxyID, const collision::CAABB& _oAABB) override;
+    virtual void SetProxyStatic(uint32_t _uProxyID, bool _bStatic) override;
+    virtual void SetProxyLayers(uint32_t _uProxyID, uint32_t _uLayers, uint32_t _uLayerFilter) override;
+
+    // Collect the overlapping pairs
+    virtual void UpdatePairs(TPairList& _lstPairs_) override;
+
+    virtual void QueryRay(const physics::CRay& _oRay, float _fMaxDistance, TColliderList& _lstColliders_) override;
+    virtual void QueryAABB(const collision::CAABB& _oAABB, TColliderList& _lstColliders_) override;
+
+    virtual void CopyFrom(const CBroadPhase& _rOther) override;
+
+    inline int32_t GetHeight() const { return m_iRoot != s_iNullNode ? m_lstNodes[m_iRoot].Height : 0; }
+    inline size_t GetProxyCount() const { return m_tProxyCount; }
+
+  private:
+    struct TTreeNode
+    {
+      collision::CAABB AABB = collision::CAABB(); // Fat bounds on leaves
+      collision::CAABB ProxyAABB = collision::CAABB(); // Only leaves
+      collision::CCollider* Collider = nullptr; // Only leaves
+      uint32_t ColliderID = 0; // Only leaves
+      uint32_t Layers = 0xFFFFFFFFu; // Only leaves
+      uint32_t LayerFilter = 0xFFFFFFFFu; // Only leaves
+      bool Static = false; // Only leaves
+
+      int32_t Parent = s_iNullNode; // Next free node when unused
+      int32_t Left = s_iNullNode;
+      int32_t Right = s_iNullNode;
+      int32_t Height = -1; // Leaf = 0, free node = -1
+
+      inline bool IsLeaf() const { return Left == s_iNullNode; }
+    };
+
+  private:
+    int32_t AllocateNode();
+    void FreeNode(int32_t _iNode);
+
+    void InsertLeaf(int32_t _iLeaf);
+    void RemoveLeaf(int32_t _iLeaf);
+    int32_t Balance(int32_t _iNode);
+    void Refit(int32_t _iNode);
+
+    template<typename TVisitor>
+    void Query(const collision::CAABB& _oAABB, TVisitor&& _oVisitor);
+
+  private:
+    std::vector<TTreeNode> m_lstNodes;
+    std::vector<int32_t> m_lstStack;
+
+    int32_t m_iRoot = s_iNullNode;
+    int32_t m_iFreeList = s_iNullNode;
+    size_t m_tProxyCount = 0;
+  };
+}
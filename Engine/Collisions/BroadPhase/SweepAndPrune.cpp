@@ -0,0 +1,247 @@
+#include "SweepAndPrune.h"
+#include "Engine/Collisions/Collider.h"
+#include <algorithm>
+#include <cassert>
+
+namespace collision
+{
+  namespace internal_sweep_and_prune
+  {
+    static constexpr float s_fAxisSwitchFactor = 1.25f; // Variance ratio needed to change the swept axis
+
+    inline uint32_t PackEndPoint(uint32_t _uProxyID, bool _bMax)
+    {
+      return (_uProxyID << 1) | (_bMax ? 1u : 0u);
+    }
+  }
+  // ------------------------------------
+  uint32_t CSweepAndPrune::CreateProxy(collision::CCollider* _pCollider, const collision::CAABB& _oAABB)
+  {
+#ifdef _DEBUG
+    assert(_pCollider);
+#endif
+    uint32_t uProxyID = static_cast<uint32_t>(m_lstProxies.size());
+    if (!m_lstFreeProxies.empty())
+    {
+      uProxyID = m_lstFreeProxies.back();
+      m_lstFreeProxies.pop_back();
+    }
+    else
+    {
+      m_lstProxies.emplace_back();
+    }
+
+    TProxy& rProxy = m_lstProxies[uProxyID];
+    rProxy.AABB = _oAABB;
+    rProxy.Collider = _pCollider;
+    rProxy.ColliderID = _pCollider->GetID();
+    rProxy.Layers = 0xFFFFFFFFu;
+    rProxy.LayerFilter = 0xFFFFFFFFu;
+    rProxy.Static = false;
+
+    // Append endpoints, the next sort will move them to their place
+    for (uint32_t uAxis = 0; uAxis < s_uAxisCount; ++uAxis)
+    {
+      TEndPoint oMin, oMax;
+      oMin.Value = rProxy.AABB.GetMin()[uAxis];
+      oMin.Data = internal_sweep_and_prune::PackEndPoint(uProxyID, false);
+      oMax.Value = rProxy.AABB.GetMax()[uAxis];
+      oMax.Data = internal_sweep_and_prune::PackEndPoint(uProxyID, true);
+
+      m_lstEndPoints[uAxis].emplace_back(oMin);
+      m_lstEndPoints[uAxis].emplace_back(oMax);
+    }
+    return uProxyID;
+  }
+  // ------------------------------------
+  void CSweepAndPrune::DestroyProxy(uint32_t _uProxyID)
+  {
+    if (_uProxyID >= m_lstProxies.size() || !m_lstProxies[_uProxyID].Collider)
+    {
+      return;
+    }
+
+    // Remove endpoints (keeps the order of the remaining ones)
+    for (uint32_t uAxis = 0; uAxis < s_uAxisCount; ++uAxis)
+    {
+      std::vector<TEndPoint>& lstEndPoints = m_lstEndPoints[uAxis];
+      lstEndPoints.erase(std::remove_if(lstEndPoints.begin(), lstEndPoints.end(),
+        [_uProxyID](const TEndPoint& _rEndPoint) { return _rEndPoint.GetProxyID() == _uProxyID; }), lstEndPoints.end());
+    }
+
+    m_lstProxies[_uProxyID] = TProxy();
+    m_lstFreeProxies.emplace_back(_uProxyID);
+  }
+  // ------------------------------------
+  void CSweepAndPrune::MoveProxy(uint32_t _uProxyID, const collision::CAABB& _oAABB)
+  {
+#ifdef _DEBUG
+    assert(_uProxyID < m_lstProxies.size() && m_lstProxies[_uProxyID].Collider);
+#endif
+    m_lstProxies[_uProxyID].AABB = _oAABB;
+  }
+  // ------------------------------------
+  void CSweepAndPrune::SetProxyStatic(uint32_t _uProxyID, bool _bStatic)
+  {
+#ifdef _DEBUG
+    assert(_uProxyID < m_lstProxies.size() && m_lstProxies[_uProxyID].Collider);
+#endif
+    m_lstProxies[_uProxyID].Static = _bStatic;
+  }
+  // ------------------------------------
+  void CSweepAndPrune::SetProxyLayers(uint32_t _uProxyID, uint32_t _uLayers, uint32_t _uLayerFilter)
+  {
+#ifdef _DEBUG
+    assert(_uProxyID < m_lstProxies.size() && m_lstProxies[_uProxyID].Collider);
+#endif
+    m_lstProxies[_uProxyID].Layers = _uLayers;
+    m_lstProxies[_uProxyID].LayerFilter = _uLayerFilter;
+  }
+  // ------------------------------------
+  void CSweepAndPrune::UpdatePairs(TPairList& _lstPairs_)
+  {
+    _lstPairs_.clear();
+
+    // Only the swept axis is updated, an axis that becomes the swept one is sorted from scratch (stale order)
+    const uint32_t uSweepAxis = ComputeSweepAxis();
+    std::vector<TEndPoint>& lstEndPoints = m_lstEndPoints[uSweepAxis];
+    RefreshEndPoints(uSweepAxis);
+    if (uSweepAxis != m_uSweepAxis)
+    {
+      std::sort(lstEndPoints.begin(), lstEndPoints.end());
+      m_uSweepAxis = uSweepAxis;
+    }
+    else
+    {
+      SortAxis(lstEndPoints);
+    }
+
+    // Sweep
+    m_lstActiveProxies.clear();
+    for (const TEndPoint& rEndPoint : lstEndPoints)
+    {
+      uint32_t uProxyID = rEndPoint.GetProxyID();
+      TProxy& rProxy = m_lstProxies[uProxyID];
+
+      if (rEndPoint.IsMax())
+      {
+        // Swap and pop from the active list
+        uint32_t uLastProxyID = m_lstActiveProxies.back();
+        m_lstActiveProxies[rProxy.ActiveIdx] = uLastProxyID;
+        m_lstProxies[uLastProxyID].ActiveIdx = rProxy.ActiveIdx;
+        m_lstActiveProxies.pop_back();
+        continue;
+      }
+
+      // Test against every open interval
+      for (uint32_t uActiveProxyID : m_lstActiveProxies)
+      {
+        const TProxy& rActiveProxy = m_lstProxies[uActiveProxyID];
+        bool bFiltered = !collision::CheckPairFilter(rProxy.Static, rProxy.LayerFilter, rActiveProxy.Static, rActiveProxy.Layers);
+        if (!bFiltered && collision::CheckOverlap(rProxy.AABB, rActiveProxy.AABB))
+        {
+          // Keep the creation order (same order as the collider list)
+          bool bSorted = rActiveProxy.ColliderID < rProxy.ColliderID;
+          const TProxy& rProxyA = bSorted ? rActiveProxy : rProxy;
+          const TProxy& rProxyB = bSorted ? rProxy : rActiveProxy;
+
+          collision::TCollisionPair& rPair = _lstPairs_.emplace_back();
+          rPair.Key = collision::MakePairKey(rProxyA.ColliderID, rProxyB.ColliderID);
+          rPair.ColliderA = rProxyA.Collider;
+          rPair.ColliderB = rProxyB.Collider;
+        }
+      }
+
+      rProxy.ActiveIdx = static_cast<uint32_t>(m_lstActiveProxies.size());
+      m_lstActiveProxies.emplace_back(uProxyID);
+    }
+
+    // Deterministic order
+    SortPairs(_lstPairs_);
+  }
+  // ------------------------------------
+  void CSweepAndPrune::QueryRay(const physics::CRay& _oRay, float _fMaxDistance, TColliderList& _lstColliders_)
+  {
+    _lstColliders_.clear();
+    for (const TProxy& rProxy : m_lstProxies)
+    {
+      if (rProxy.Collider && collision::IntersectRay(rProxy.AABB, _oRay, _fMaxDistance))
+      {
+        _lstColliders_.emplace_back(rProxy.Collider);
+      }
+    }
+  }
+  // ------------------------------------
+  void CSweepAndPrune::CopyFrom(const CBroadPhase& _rOther)
+  {
+#ifdef _DEBUG
+    assert(_rOther.GetType() == GetType());
+#endif
+    // Sorted endpoints included, the next update starts from the same order
+    *this = static_cast<const CSweepAndPrune&>(_rOther);
+  }
+  // ------------------------------------
+  void CSweepAndPrune::QueryAABB(const collision::CAABB& _oAABB, TColliderList& _lstColliders_)
+  {
+    _lstColliders_.clear();
+    for (const TProxy& rProxy : m_lstProxies)
+    {
+      if (rProxy.Collider && collision::CheckOverlap(rProxy.AABB, _oAABB))
+      {
+        _lstColliders_.emplace_back(rProxy.Collider);
+      }
+    }
+  }
+  // ------------------------------------
+  void CSweepAndPrune::RefreshEndPoints(uint32_t _uAxis)
+  {
+    for (TEndPoint& rEndPoint : m_lstEndPoints[_uAxis])
+    {
+      const collision::CAABB& rAABB = m_lstProxies[rEndPoint.GetProxyID()].AABB;
+      rEndPoint.Value = rEndPoint.IsMax() ? rAABB.GetMax()[_uAxis] : rAABB.GetMin()[_uAxis];
+    }
+  }
+  // ------------------------------------
+  void CSweepAndPrune::SortAxis(std::vector<TEndPoint>& _lstEndPoints_)
+  {
+    // Insertion sort, almost O(n) thanks to frame coherence
+    for (size_t tI = 1; tI < _lstEndPoints_.size(); ++tI)
+    {
+      TEndPoint oEndPoint = _lstEndPoints_[tI];
+      size_t tJ = tI;
+      while (tJ > 0 && oEndPoint < _lstEndPoints_[tJ - 1])
+      {
+        _lstEndPoints_[tJ] = _lstEndPoints_[tJ - 1];
+        --tJ;
+      }
+      _lstEndPoints_[tJ] = oEndPoint;
+    }
+  }
+  // ------------------------------------
+  uint32_t CSweepAndPrune::ComputeSweepAxis() const
+  {
+    // Sweep along the axis with the largest spread of centers (less false positives)
+    math::CVector3 v3Sum = math::CVector3::Zero;
+    math::CVector3 v3SqrSum = math::CVector3::Zero;
+    for (const TProxy& rProxy : m_lstProxies)
+    {
+      if (rProxy.Collider)
+      {
+        math::CVector3 v3Center = rProxy.AABB.GetCenter();
+        v3Sum += v3Center;
+        v3SqrSum += v3Center * v3Center;
+      }
+    }
+
+    float fCount = static_cast<float>(math::Max<size_t>(GetProxyCount(), 1));
+    math::CVector3 v3Variance = (v3SqrSum / fCount) - ((v3Sum * v3Sum) / (fCount * fCount));
+
+    uint32_t uAxis = 0;
+    if (v3Variance.y > v3Variance[uAxis]) { uAxis = 1; }
+    if (v3Variance.z > v3Variance[uAxis]) { uAxis = 2; }
+
+    // Switching sorts the new axis from scratch, similar spreads keep the current axis
+    bool bKeepAxis = m_uSweepAxis < s_uAxisCount && v3Variance[uAxis] <= v3Variance[m_uSweepAxis] * internal_sweep_and_prune::s_fAxisSwitchFactor;
+    return bKeepAxis ? m_uSweepAxis : uAxis;
+  }
+}
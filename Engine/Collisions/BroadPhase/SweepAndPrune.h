@@ -0,0 +1,72 @@
+#pragma once
+#include "BroadPhase.h"
+
+namespace collision
+{
+  // Incremental sweep-and-prune: endpoints stay sorted between frames, so the insertion sort is almost linear. The
+  // endpoints of the three axes are kept, only the axis with the largest spread is sorted and swept
+  class CSweepAndPrune final : public CBroadPhase
+  {
+  public:
+    static constexpr uint32_t s_uAxisCount = 3u;
+
+  public:
+    CSweepAndPrune() : CBroadPhase(EBroadPhaseType::SWEEP_AND_PRUNE) {}
+    ~CSweepAndPrune() {}
+
+    virtual uint32_t CreateProxy(collision::CCollider* _pCollider, const collision::CAABB& _oAABB) override;
+    virtual void DestroyProxy(uint32_t _uProxyID) override;
+    virtual void MoveProxy(uint32_t _uProxyID, const collision::CAABB& _oAABB) override;
+    virtual void SetProxyStatic(uint32_t _uProxyID, bool _bStatic) override;
+    virtual void SetProxyLayers(uint32_t _uProxyID, uint32_t _uLayers, uint32_t _uLayerFilter) override;
+
+    // Keep the swept axis sorted and collect the overlapping pairs
+    virtual void UpdatePairs(TPairList& _lstPairs_) override;
+
+    virtual void QueryRay(const physics::CRay& _oRay, float _fMaxDistance, TColliderList& _lstColliders_) override;
+    virtual void QueryAABB(const collision::CAABB& _oAABB, TColliderList& _lstColliders_) override;
+
+    virtual void CopyFrom(const CBroadPhase& _rOther) override;
+
+    inline size_t GetProxyCount() const { return m_lstProxies.size() - m_lstFreeProxies.size(); }
+
+  private:
+    struct TEndPoint
+    {
+      float Value = 0.0f;
+      uint32_t Data = 0; // Proxy id + max flag
+
+      inline uint32_t GetProxyID() const { return Data >> 1; }
+      inline bool IsMax() const { return (Data & 1u) != 0; }
+      inline bool operator<(const TEndPoint& _rOther) const
+      {
+        // Min endpoints go first on ties, touching bounds are overlapping bounds
+        return Value < _rOther.Value || (Value == _rOther.Value && !IsMax() && _rOther.IsMax());
+      }
+    };
+
+    struct TProxy
+    {
+      collision::CAABB AABB = collision::CAABB();
+      collision::CCollider* Collider = nullptr;
+      uint32_t ColliderID = 0;
+      uint32_t ActiveIdx = 0;
+      uint32_t Layers = 0xFFFFFFFFu;
+      uint32_t LayerFilter = 0xFFFFFFFFu;
+      bool Static = false;
+    };
+
+  private:
+    void RefreshEndPoints(uint32_t _uAxis);
+    void SortAxis(std::vector<TEndPoint>& _lstEndPoints_);
+    uint32_t ComputeSweepAxis() const;
+
+  private:
+    std::vector<TProxy> m_lstProxies;
+    std::vector<uint32_t> m_lstFreeProxies;
+
+    std::vector<TEndPoint> m_lstEndPoints[s_uAxisCount]; // Only the swept axis is kept sorted
+    uint32_t m_uSweepAxis = s_uAxisCount; // None yet
+    std::vector<uint32_t> m_lstActiveProxies;
+  };
+}
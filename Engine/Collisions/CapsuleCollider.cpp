@@ -64,6 +64,23 @@ namespace collision
     m_v3EndSegmentPoint = v3WorldPos + (v3TargetAxis * fHalfSize);
     m_v3StartSegmentPoint = v3WorldPos - (v3TargetAxis * fHalfSize);
     m_v3SegmentDir = math::CVector3::Normalize(m_v3EndSegmentPoint - m_v3StartSegmentPoint);
+
+    // Set bounds
+    math::CVector3 v3Radius(m_fRadius, m_fRadius, m_fRadius);
+    math::CVector3 v3Min
+    (
+      math::Min(m_v3StartSegmentPoint.x, m_v3EndSegmentPoint.x),
+      math::Min(m_v3StartSegmentPoint.y, m_v3EndSegmentPoint.y),
+      math::Min(m_v3StartSegmentPoint.z, m_v3EndSegmentPoint.z)
+    );
+    math::CVector3 v3Max
+    (
+      math::Max(m_v3StartSegmentPoint.x, m_v3EndSegmentPoint.x),
+      math::Max(m_v3StartSegmentPoint.y, m_v3EndSegmentPoint.y),
+      math::Max(m_v3StartSegmentPoint.z, m_v3EndSegmentPoint.z)
+    );
+    m_oBoundingBox.SetMin(v3Min - v3Radius);
+    m_oBoundingBox.SetMax(v3Max + v3Radius);
   }
   // ------------------------------------
   void CCapsuleCollider::SetRadius(float _fRadius)
@@ -197,7 +214,7 @@ namespace collision
   {
     float fCapsuleRadius = GetRadius();
     math::CVector3 v3HalfSize = _pOther->GetHalfSize();
-    std::vector<math::CVector3> v3AxisDirectors = _pOther->GetAxisDirectors();
+    const CBoxCollider::TAxisDirectors v3AxisDirectors = _pOther->GetAxisDirectors();
 
     // Values
     float fMinDist = FLT_MAX;
@@ -8,6 +8,9 @@ namespace collision
 {
   class CCapsuleCollider final : public CCollider
   {
+  public:
+    friend class CNarrowPhase;
+
   public:
     CCapsuleCollider(void* _pOwner) : CCollider(EColliderType::CAPSULE_COLLIDER, _pOwner) {}
     ~CCapsuleCollider() {}
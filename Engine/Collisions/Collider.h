@@ -1,7 +1,11 @@
 #pragma once
 #include "Libs/Math/Transform.h"
+#include "Engine/Collisions/AABB.h"
 #include "Engine/Utils/Ray.h"
 #include "Libs/Utils/Delegate.h"
+#include "Libs/Utils/WeakPtr.h"
+
+namespace physics { class CRigidbody; }
 
 // Interface
 namespace collision
@@ -32,6 +36,7 @@ namespace collision
     float Depth = 0.0f;
     float Distance = 0.0f;
     void* Object = nullptr;
+    bool Trigger = false; // Overlap of a trigger collider, no contact data
   };
 
   class CCollider
@@ -50,10 +55,28 @@ namespace collision
 
     inline void* GetOwner() const { return m_pOwner; }
     inline const collision::EColliderType& GetType() const { return m_eColliderType; }
+    inline const uint32_t& GetID() const { return m_uColliderID; }
+
+    // World bounds (broad-phase)
+    inline const collision::CAABB& GetBoundingBox() const { return m_oBoundingBox; }
 
     inline void SetCollisionMask(const ECollisionMask& _eCollisionMask) { m_eCollisionMask = _eCollisionMask; }
     inline const collision::ECollisionMask& GetCollisionMask() const { return m_eCollisionMask; }
 
+    // Static colliders are never tested against each other
+    inline void SetStatic(bool _bStatic) { m_bStatic = _bStatic; }
+    inline bool IsStatic() const { return m_bStatic; }
+    // Triggers only report overlaps (enter / stay / exit), they have no contacts and no physics response
+    inline void SetTrigger(bool _bTrigger) { m_bTrigger = _bTrigger; }
+    inline bool IsTrigger() const { return m_bTrigger; }
+    // Last collision step with new bounds or a new transform (idle since then)
+    inline const uint32_t& GetLastMovedFrame() const { return m_uLastMovedFrame; }
+
+    // Body that receives the contact impulses (null = immovable)
+    inline void SetRigidbody(const utils::CWeakPtr<physics::CRigidbody>& _wpRigidbody) { m_wpRigidbody = _wpRigidbody; }
+    inline physics::CRigidbody* GetRigidbody() const { return m_wpRigidbody.GetPtr(); }
+
+    inline const math::CTransform& GetTransform() const { return m_oTransform; }
     inline math::CVector3 GetPos() const { return m_oTransform.GetPos(); }
     inline void SetPos(const math::CVector3& _v3Pos) { m_oTransform.SetPos(_v3Pos); }
     inline math::CVector3 GetRot() const { return m_oTransform.GetRot(); }
@@ -70,6 +93,9 @@ namespace collision
     virtual void DrawDebug() = 0;
 #endif // _DEBUG
 
+  protected:
+    collision::CAABB m_oBoundingBox = collision::CAABB();
+
   private:
     TOnCollisionEvent m_oOnCollisionEnter;
     TOnCollisionEvent m_oOnCollisionStay;
@@ -78,9 +104,17 @@ namespace collision
     math::CTransform m_oTransform = math::CTransform();
     EColliderType m_eColliderType = EColliderType::INVALID;
     ECollisionMask m_eCollisionMask = ECollisionMask::DEFAULT;
+    bool m_bStatic = false;
+    bool m_bTrigger = false;
 
   private:
     void* m_pOwner = nullptr;
+    utils::CWeakPtr<physics::CRigidbody> m_wpRigidbody;
+    uint32_t m_uColliderID = 0;
+    uint32_t m_uProxyID = 0;
+    uint32_t m_uDenseIdx = 0;
+    uint32_t m_uLastMovedFrame = 0;
+    bool m_bPendingDestroy = false; // Destroyed while the events were dispatched
   };
 }
 
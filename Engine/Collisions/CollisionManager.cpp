@@ -3,118 +3,461 @@
 #include "Engine/Collisions/BoxCollider.h"
 #include "Engine/Collisions/SphereCollider.h"
 #include "Engine/Collisions/CapsuleCollider.h"
+#include "Engine/Collisions/BroadPhase/SweepAndPrune.h"
+#include "Engine/Collisions/BroadPhase/DynamicTree.h"
+#include "Engine/Physics/Rigidbody.h"
 
 #include "Libs/Macros/GlobalMacros.h"
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
 
 namespace collision
 {
+  namespace internal_collision_manager
+  {
+    static constexpr float s_fSweepStepFactor = 0.5f; // Step of the sweeps (probe radius)
+    static constexpr float s_fMinSweepStep = 0.01f;
+    static constexpr uint32_t s_uSweepIterations = 8u;
+    static constexpr float s_fSweepSlideTolerance = 0.05f; // Cosine, gravity tilts a sliding motion into the floor
+
+    std::unique_ptr<collision::CBroadPhase> CreateBroadPhase(collision::EBroadPhaseType _eBroadPhaseType)
+    {
+      switch (_eBroadPhaseType)
+      {
+        case collision::EBroadPhaseType::DYNAMIC_TREE: return std::make_unique<collision::CDynamicTree>();
+        default: return std::make_unique<collision::CSweepAndPrune>();
+      }
+    }
+
+    bool HasMoved(const collision::CAABB& _oPrevAABB, const collision::CAABB& _oAABB, const math::CTransform& _oPrevTransform, const math::CTransform& _oTransform)
+    {
+      // Exact compare, any change (shape, rotation...) invalidates the cached results
+      return _oPrevAABB.GetMin() != _oAABB.GetMin() || _oPrevAABB.GetMax() != _oAABB.GetMax() ||
+        std::memcmp(&_oPrevTransform.GetMatrix(), &_oTransform.GetMatrix(), sizeof(math::CMatrix4x4)) != 0;
+    }
+
+    inline bool IsSleeping(const collision::CCollider* _pCollider)
+    {
+      const physics::CRigidbody* pRigidbody = _pCollider->GetRigidbody();
+      return pRigidbody && pRigidbody->IsSleeping();
+    }
+
+    // Static or sleeping: registered as a static proxy
+    inline bool IsFrozen(const collision::CCollider* _pCollider)
+    {
+      return _pCollider->IsStatic() || IsSleeping(_pCollider);
+    }
+
+    // Frozen pairs are not reported by the broad-phase, their contacts stay without events
+    inline bool IsFrozenContact(const collision::CCollisionManager::TContact& _rContact)
+    {
+      return IsFrozen(_rContact.ColliderA) && IsFrozen(_rContact.ColliderB) && (IsSleeping(_rContact.ColliderA) || IsSleeping(_rContact.ColliderB));
+    }
+
+    // Exits have no contact data, only the trigger flag of the last contact
+    inline collision::THitEvent CreateExitEvent(const collision::CCollisionManager::TContact& _rContact)
+    {
+      collision::THitEvent oHitEvent = collision::THitEvent();
+      oHitEvent.Trigger = _rContact.HitEvent.Trigger;
+      return oHitEvent;
+    }
+
+    void SortByID(collision::CBroadPhase::TColliderList& _lstColliders_)
+    {
+      // Same order as the collider list, hits on equal distances stay deterministic
+      std::sort(_lstColliders_.begin(), _lstColliders_.end(), [](const collision::CCollider* _pA, const collision::CCollider* _pB)
+      {
+        return _pA->GetID() < _pB->GetID();
+      });
+    }
+  }
+  // ------------------------------------
+  CCollisionManager::CCollisionManager()
+  {
+    std::fill(std::begin(m_lstLayerMatrix), std::end(m_lstLayerMatrix), 0xFFFFFFFFu);
+    m_pBroadPhase = internal_collision_manager::CreateBroadPhase(collision::EBroadPhaseType::SWEEP_AND_PRUNE);
+  }
+  // ------------------------------------
+  void CCollisionManager::SetBroadPhaseType(collision::EBroadPhaseType _eBroadPhaseType)
+  {
+    if (m_pBroadPhase->GetType() == _eBroadPhaseType)
+    {
+      return;
+    }
+
+    // Register the current colliders in the new broad-phase
+    m_pBroadPhase = internal_collision_manager::CreateBroadPhase(_eBroadPhaseType);
+    for (size_t tIndex = 0; tIndex < m_oColliderData.GetSize(); ++tIndex)
+    {
+      collision::CCollider* pCollider = m_oColliderData.Colliders[tIndex].get();
+      m_oColliderData.ProxyIDs[tIndex] = m_pBroadPhase->CreateProxy(pCollider, m_oColliderData.AABBs[tIndex]);
+      pCollider->m_uProxyID = m_oColliderData.ProxyIDs[tIndex];
+      m_pBroadPhase->SetProxyStatic(pCollider->m_uProxyID, m_oColliderData.Statics[tIndex]);
+      const collision::ECollisionMask& eLayers = m_oColliderData.Masks[tIndex];
+      m_pBroadPhase->SetProxyLayers(pCollider->m_uProxyID, static_cast<uint32_t>(eLayers), ComputeLayerFilter(eLayers));
+    }
+  }
   // ------------------------------------
   void CCollisionManager::Update(float /*_fDeltaTime*/)
   {
-    // Check collisions with early-exit optimization for inactive objects
-    for (uint32_t uI = 0; uI < m_lstColliders.GetCurrentSize(); ++uI)
+    m_uFrameStamp++;
+
+    // Broad-phase: only pairs with overlapping bounds reach the narrow-phase
+    SyncColliderData();
+    m_pBroadPhase->UpdatePairs(m_lstCollisionPairs);
+
+    // Narrow-phase: one result per pair (idle pairs keep the cached one)
+    m_oNarrowPhase.Execute(m_lstCollisionPairs, m_uFrameStamp, m_lstPairResults);
+
+    // Contacts of this step, the previous ones are merged with the sorted candidate pairs
+    m_lstCurrentContacts.clear();
+    m_lstEvents.clear();
+
+    size_t tPrevIdx = 0;
+    const size_t tPrevCount = m_lstContacts.size();
+    for (size_t tPairIdx = 0; tPairIdx < m_lstCollisionPairs.size(); ++tPairIdx)
     {
-      // Get current collider
-      collision::CCollider* pCollider = m_lstColliders[uI];
+      const collision::TCollisionPair& rPair = m_lstCollisionPairs[tPairIdx];
+      const uint64_t& uKey = rPair.Key;
 
-      // Early-exit: skip static colliders that haven't moved
-      // (Optimization: only check against dynamic objects or recently moved ones)
-      // TODO: Implement spatial partitioning for O(n) broad-phase instead of O(n²)
+      // Collision Exit (bounds are not overlapping anymore)
+      while (tPrevIdx < tPrevCount && m_lstContacts[tPrevIdx].Key < uKey)
+      {
+        KeepOrExitContact(m_lstContacts[tPrevIdx++]);
+      }
 
-      // Initialize the set of previous colliders for this collider if not already done
-      if (m_dctHandleCollisions.find(pCollider) == m_dctHandleCollisions.end())
+      const TContact* pPrevContact = nullptr;
+      if (tPrevIdx < tPrevCount && m_lstContacts[tPrevIdx].Key == uKey)
       {
-        m_dctHandleCollisions[pCollider] = std::unordered_set<collision::CCollider*>();
+        pPrevContact = &m_lstContacts[tPrevIdx++];
       }
 
-      for (uint32_t uJ = uI + 1; uJ < m_lstColliders.GetCurrentSize(); ++uJ)
+      // Idle pairs (neither collider moved) keep the previous result
+      const collision::TPairResult& rResult = m_lstPairResults[tPairIdx];
+      bool bHit = rResult.Cached ? pPrevContact != nullptr : rResult.Hit;
+      if (bHit)
       {
-        // Get target collider
-        collision::CCollider* pTargetCollider = m_lstColliders[uJ];
+        // Register collision
+        TContact& rContact = m_lstCurrentContacts.emplace_back();
+        rContact.Key = uKey;
+        rContact.ColliderA = rPair.ColliderA;
+        rContact.ColliderB = rPair.ColliderB;
+        rContact.StartFrame = pPrevContact ? pPrevContact->StartFrame : m_uFrameStamp;
+        rContact.HitEvent = rResult.Cached ? pPrevContact->HitEvent : rResult.HitEvent;
 
-        // Create hit event data
-        collision::THitEvent oHitEvent = collision::THitEvent();
-        if (pCollider->CheckCollision(*pTargetCollider, oHitEvent))
-        {
-          // Collision Enter
-          bool bCollisionEnter = m_dctHandleCollisions[pCollider].find(pTargetCollider) == m_dctHandleCollisions[pCollider].end();
-          if (!bCollisionEnter)
-          {
-            // Notify to current collider
-            oHitEvent.Object = pTargetCollider->GetOwner();
-            pCollider->m_oOnCollisionEnter(oHitEvent);
-
-            // Notification to target collider
-            oHitEvent.Normal *= -1.0f;
-            oHitEvent.Object = pCollider->GetOwner();
-            pTargetCollider->m_oOnCollisionEnter(oHitEvent);
-
-            // Register collision
-            m_dctHandleCollisions[pCollider].insert(pTargetCollider);
-          }
-          else // Collision Stay
-          {
-            // Notify to current collider
-            oHitEvent.Object = pTargetCollider->GetOwner();
-            pCollider->m_oOnCollisionStay(oHitEvent);
-
-            // Notification to target collider
-            oHitEvent.Normal *= -1.0f;
-            oHitEvent.Object = pCollider->GetOwner();
-            pTargetCollider->m_oOnCollisionStay(oHitEvent);
-          }
-        }
-        else // Collision Exit
-        {
-          if (m_dctHandleCollisions[pCollider].find(pTargetCollider) != m_dctHandleCollisions[pCollider].end())
-          {
-            // Notify to current collider
-            oHitEvent.Object = pTargetCollider->GetOwner();
-            pCollider->m_oOnCollisionExit(oHitEvent);
-
-            // Notification to target collider
-            oHitEvent.Object = pCollider->GetOwner();
-            pTargetCollider->m_oOnCollisionExit(oHitEvent);
-
-            // Remove from the previous collisions
-            m_dctHandleCollisions[pCollider].erase(pTargetCollider);
-          }
-        }
+        // Collision Enter / Stay
+        ECollisionEvent eType = pPrevContact ? ECollisionEvent::STAY : ECollisionEvent::ENTER;
+        m_lstEvents.push_back({ eType, rPair.ColliderA, rPair.ColliderB, rContact.HitEvent });
+      }
+      else if (pPrevContact) // Collision Exit
+      {
+        m_lstEvents.push_back({ ECollisionEvent::EXIT, rPair.ColliderA, rPair.ColliderB, internal_collision_manager::CreateExitEvent(*pPrevContact) });
       }
     }
+
+    // Collision Exit (remaining contacts)
+    while (tPrevIdx < tPrevCount)
+    {
+      KeepOrExitContact(m_lstContacts[tPrevIdx++]);
+    }
+
+    // Keep both buffers, no allocations once they have grown
+    m_lstContacts.swap(m_lstCurrentContacts);
+
+    // The handlers can move or destroy colliders, the step is already done
+    DispatchEvents();
   }
   // ------------------------------------
-  collision::CCollider* CCollisionManager::CreateCollider(collision::EColliderType _eColliderType, void* _pOwner)
+  void CCollisionManager::KeepOrExitContact(const TContact& _rContact)
   {
-    if (m_lstColliders.GetCurrentSize() >= m_lstColliders.GetMaxSize())
+    // Sleeping contacts are kept (merge order, the list stays sorted)
+    if (internal_collision_manager::IsFrozenContact(_rContact))
     {
-      WARNING_LOG("You have reached maximum colliders!");
-      return nullptr;
+      m_lstCurrentContacts.emplace_back(_rContact);
     }
+    else
+    {
+      m_lstEvents.push_back({ ECollisionEvent::EXIT, _rContact.ColliderA, _rContact.ColliderB, internal_collision_manager::CreateExitEvent(_rContact) });
+    }
+  }
+  // ------------------------------------
+  collision::CCollider* CCollisionManager::CreateCollider(collision::EColliderType _eColliderType, void* _pOwner)
+  {
+    std::unique_ptr<collision::CCollider> pNewCollider = nullptr;
     switch (_eColliderType)
     {
-      case collision::EColliderType::BOX_COLLIDER: return m_lstColliders.Create<collision::CBoxCollider>(_pOwner);
-      case collision::EColliderType::SPHERE_COLLIDER: return m_lstColliders.Create<collision::CSphereCollider>(_pOwner);
-      case collision::EColliderType::CAPSULE_COLLIDER: return m_lstColliders.Create<collision::CCapsuleCollider>(_pOwner);
+      case collision::EColliderType::BOX_COLLIDER: pNewCollider = std::make_unique<collision::CBoxCollider>(_pOwner); break;
+      case collision::EColliderType::SPHERE_COLLIDER: pNewCollider = std::make_unique<collision::CSphereCollider>(_pOwner); break;
+      case collision::EColliderType::CAPSULE_COLLIDER: pNewCollider = std::make_unique<collision::CCapsuleCollider>(_pOwner); break;
       default: return nullptr;
     }
+
+    // Register in the dense data and the broad-phase
+    collision::CCollider* pCollider = pNewCollider.get();
+    pCollider->m_uColliderID = m_uNextColliderID++;
+    pCollider->m_uDenseIdx = m_oColliderData.Add(std::move(pNewCollider));
+    pCollider->m_uLastMovedFrame = m_uFrameStamp + 1; // Tested on the next step
+
+    pCollider->m_uProxyID = m_pBroadPhase->CreateProxy(pCollider, pCollider->GetBoundingBox());
+    m_oColliderData.ProxyIDs[pCollider->m_uDenseIdx] = pCollider->m_uProxyID;
+    const collision::ECollisionMask& eLayers = pCollider->GetCollisionMask();
+    m_pBroadPhase->SetProxyLayers(pCollider->m_uProxyID, static_cast<uint32_t>(eLayers), ComputeLayerFilter(eLayers));
+    return pCollider;
   }
   // ------------------------------------
   void CCollisionManager::DestroyCollider(collision::CCollider*& _pCollider_)
   {
-    bool bOk = m_lstColliders.Remove(_pCollider_);
-    if (!bOk) { std::cout << "Error removing collider!" << std::endl; }
+    const uint32_t uDenseIdx = _pCollider_ ? _pCollider_->m_uDenseIdx : 0;
+    bool bOk = _pCollider_ && !_pCollider_->m_bPendingDestroy && uDenseIdx < m_oColliderData.GetSize() && m_oColliderData.Colliders[uDenseIdx].get() == _pCollider_;
+    if (!bOk)
+    {
+      std::cout << "Error removing collider!" << std::endl;
+      _pCollider_ = nullptr;
+      return;
+    }
+
+    // Destroyed from a collision handler, removed once the events are dispatched
+    if (m_bDispatchingEvents)
+    {
+      _pCollider_->m_bPendingDestroy = true;
+      m_lstPendingDestroy.emplace_back(_pCollider_);
+    }
+    else
+    {
+      RemoveCollider(_pCollider_);
+    }
     _pCollider_ = nullptr;
   }
   // ------------------------------------
+  void CCollisionManager::RemoveCollider(collision::CCollider* _pCollider)
+  {
+    // Unregister from the broad-phase and drop its contacts (keeps the order)
+    m_pBroadPhase->DestroyProxy(_pCollider->m_uProxyID);
+    const uint64_t uColliderID = static_cast<uint64_t>(_pCollider->GetID());
+    m_lstContacts.erase(std::remove_if(m_lstContacts.begin(), m_lstContacts.end(), [uColliderID](const TContact& _rContact)
+    {
+      return (_rContact.Key >> 32) == uColliderID || (_rContact.Key & 0xFFFFFFFFull) == uColliderID;
+    }), m_lstContacts.end());
+
+    const uint32_t uDenseIdx = _pCollider->m_uDenseIdx;
+    m_oColliderData.Remove(uDenseIdx);
+    if (uDenseIdx < m_oColliderData.GetSize())
+    {
+      m_oColliderData.Colliders[uDenseIdx]->m_uDenseIdx = uDenseIdx;
+    }
+  }
+  // ------------------------------------
+  void CCollisionManager::SaveSnapshot(TSnapshot& _rSnapshot_) const
+  {
+    _rSnapshot_.Colliders.resize(m_oColliderData.GetSize());
+    for (size_t tIndex = 0; tIndex < m_oColliderData.GetSize(); ++tIndex)
+    {
+      collision::CCollider* pCollider = m_oColliderData.Colliders[tIndex].get();
+      TSnapshot::TColliderState& rState = _rSnapshot_.Colliders[tIndex];
+      rState.Collider = pCollider;
+      rState.ProxyID = m_oColliderData.ProxyIDs[tIndex];
+      rState.Transform = pCollider->m_oTransform;
+      rState.LastMovedFrame = pCollider->m_uLastMovedFrame;
+      rState.SyncedAABB = m_oColliderData.AABBs[tIndex];
+      rState.SyncedTransform = m_oColliderData.Transforms[tIndex];
+      rState.SyncedMask = m_oColliderData.Masks[tIndex];
+      rState.SyncedStatic = m_oColliderData.Statics[tIndex];
+      rState.SyncedTrigger = m_oColliderData.Triggers[tIndex];
+    }
+
+    if (!_rSnapshot_.BroadPhase || _rSnapshot_.BroadPhase->GetType() != m_pBroadPhase->GetType())
+    {
+      _rSnapshot_.BroadPhase = internal_collision_manager::CreateBroadPhase(m_pBroadPhase->GetType());
+    }
+    _rSnapshot_.BroadPhase->CopyFrom(*m_pBroadPhase);
+
+    _rSnapshot_.Contacts = m_lstContacts;
+    _rSnapshot_.FrameStamp = m_uFrameStamp;
+  }
+  // ------------------------------------
+  bool CCollisionManager::RestoreSnapshot(const TSnapshot& _rSnapshot)
+  {
+    static_assert(std::is_trivially_copyable_v<TContact>, "Contacts are copied as plain memory");
+    if (!IsSnapshotValid(_rSnapshot))
+    {
+      return false;
+    }
+
+    for (size_t tIndex = 0; tIndex < m_oColliderData.GetSize(); ++tIndex)
+    {
+      collision::CCollider* pCollider = m_oColliderData.Colliders[tIndex].get();
+      const TSnapshot::TColliderState& rState = _rSnapshot.Colliders[tIndex];
+      pCollider->m_oTransform = rState.Transform;
+      pCollider->m_uLastMovedFrame = rState.LastMovedFrame;
+      pCollider->RecalculateCollider();
+
+      m_oColliderData.AABBs[tIndex] = rState.SyncedAABB;
+      m_oColliderData.Transforms[tIndex] = rState.SyncedTransform;
+      m_oColliderData.Masks[tIndex] = rState.SyncedMask;
+      m_oColliderData.Statics[tIndex] = rState.SyncedStatic;
+      m_oColliderData.Triggers[tIndex] = rState.SyncedTrigger;
+    }
+
+    m_pBroadPhase->CopyFrom(*_rSnapshot.BroadPhase);
+    m_lstContacts = _rSnapshot.Contacts;
+    m_uFrameStamp = _rSnapshot.FrameStamp;
+    return true;
+  }
+  // ------------------------------------
+  bool CCollisionManager::IsSnapshotValid(const TSnapshot& _rSnapshot) const
+  {
+    // The handlers run inside the update
+    if (m_bDispatchingEvents)
+    {
+      return false;
+    }
+
+    if (!_rSnapshot.BroadPhase || _rSnapshot.BroadPhase->GetType() != m_pBroadPhase->GetType() || _rSnapshot.Colliders.size() != m_oColliderData.GetSize())
+    {
+      return false;
+    }
+    for (size_t tIndex = 0; tIndex < m_oColliderData.GetSize(); ++tIndex)
+    {
+      // Same colliders with the same proxies
+      const TSnapshot::TColliderState& rState = _rSnapshot.Colliders[tIndex];
+      if (rState.Collider != m_oColliderData.Colliders[tIndex].get() || rState.ProxyID != m_oColliderData.ProxyIDs[tIndex])
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+  // ------------------------------------
   bool CCollisionManager::Raycast(const physics::CRay& _oRaycast, float _fMaxDistance, THitEvent& oHitEvent_, ECollisionMask _eMask)
   {
+    collision::TQueryHit oHit = collision::TQueryHit();
+    if (RaycastClosest(_oRaycast, _fMaxDistance, oHit, _eMask))
+    {
+      oHitEvent_ = oHit.HitEvent;
+      return true;
+    }
+    return false;
+  }
+  // ------------------------------------
+  bool CCollisionManager::RaycastAll(const physics::CRay& _oRaycast, float _fMaxDistance, std::vector<THitEvent>& _lstOutHits_, ECollisionMask _eMask)
+  {
+    _lstOutHits_.clear();
+
+    // Broad-phase: only colliders whose bounds are crossed by the ray
+    m_pBroadPhase->QueryRay(_oRaycast, _fMaxDistance, m_lstQueryColliders);
+    internal_collision_manager::SortByID(m_lstQueryColliders);
+
+    for (collision::CCollider* pCollider : m_lstQueryColliders)
+    {
+      if ((m_oColliderData.Masks[pCollider->m_uDenseIdx] & _eMask) == 0)
+      {
+        continue;
+      }
+
+      collision::THitEvent oHitEvent = collision::THitEvent();
+      bool bIntersect = pCollider->IntersectRay(_oRaycast, oHitEvent, _fMaxDistance);
+      bool bCorrectDist = oHitEvent.Distance <= _fMaxDistance;
+      if (bIntersect && bCorrectDist)
+      {
+        _lstOutHits_.emplace_back(oHitEvent);
+      }
+    }
+    return _lstOutHits_.size() > 0;
+  }
+  // ------------------------------------
+  uint32_t CCollisionManager::RaycastBatch(const physics::CRay* _pRays, uint32_t _uRayCount, float _fMaxDistance, collision::TQueryHit* _pHits_, ECollisionMask _eMask)
+  {
+    uint32_t uHitCount = 0;
+    for (uint32_t uIndex = 0; uIndex < _uRayCount; ++uIndex)
+    {
+      _pHits_[uIndex] = collision::TQueryHit();
+      uHitCount += RaycastClosest(_pRays[uIndex], _fMaxDistance, _pHits_[uIndex], _eMask) ? 1u : 0u;
+    }
+    return uHitCount;
+  }
+  // ------------------------------------
+  uint32_t CCollisionManager::OverlapSphere(const math::CVector3& _v3Center, float _fRadius, collision::CCollider** _pColliders_, uint32_t _uMaxColliders, ECollisionMask _eMask)
+  {
+    collision::CSphereCollider oProbe(nullptr);
+    oProbe.SetPos(_v3Center);
+    oProbe.SetRadius(_fRadius);
+    return Overlap(oProbe, _pColliders_, _uMaxColliders, _eMask);
+  }
+  // ------------------------------------
+  uint32_t CCollisionManager::OverlapBox(const math::CVector3& _v3Center, const math::CVector3& _v3Size, const math::CVector3& _v3Rot, collision::CCollider** _pColliders_, uint32_t _uMaxColliders, ECollisionMask _eMask)
+  {
+    collision::CBoxCollider oProbe(nullptr);
+    oProbe.SetPos(_v3Center);
+    oProbe.SetRot(_v3Rot);
+    oProbe.SetOBB(_v3Rot != math::CVector3::Zero);
+    oProbe.SetSize(_v3Size);
+    return Overlap(oProbe, _pColliders_, _uMaxColliders, _eMask);
+  }
+  // ------------------------------------
+  bool CCollisionManager::SweepSphere(const math::CVector3& _v3Origin, float _fRadius, const math::CVector3& _v3Dir, float _fMaxDistance, collision::TQueryHit& _oHit_, ECollisionMask _eMask)
+  {
+    collision::CSphereCollider oProbe(nullptr);
+    oProbe.SetPos(_v3Origin);
+    oProbe.SetRadius(_fRadius);
+    return Sweep(oProbe, _v3Origin, _v3Dir, _fMaxDistance, _fRadius * internal_collision_manager::s_fSweepStepFactor, _oHit_, _eMask);
+  }
+  // ------------------------------------
+  bool CCollisionManager::SweepCapsule(const math::CVector3& _v3Origin, float _fRadius, float _fHeight, const math::CVector3& _v3Rot, const math::CVector3& _v3Dir, float _fMaxDistance, collision::TQueryHit& _oHit_, ECollisionMask _eMask)
+  {
+    collision::CCapsuleCollider oProbe(nullptr);
+    oProbe.SetPos(_v3Origin);
+    oProbe.SetRot(_v3Rot);
+    oProbe.SetHeight(_fHeight);
+    oProbe.SetRadius(_fRadius);
+    return Sweep(oProbe, _v3Origin, _v3Dir, _fMaxDistance, _fRadius * internal_collision_manager::s_fSweepStepFactor, _oHit_, _eMask);
+  }
+  // ------------------------------------
+  bool CCollisionManager::SweepCollider(const collision::CCollider& _oCollider, const math::CVector3& _v3Displacement, collision::TQueryHit& _oHit_)
+  {
+    const float fDistance = _v3Displacement.Magnitude();
+    if (fDistance <= 0.0f)
+    {
+      return false;
+    }
+
+    // The probe is a copy of the shape, the step is half its thinnest extent
+    const ECollisionMask eMask = static_cast<ECollisionMask>(ComputeLayerFilter(_oCollider.GetCollisionMask()));
+    const float fStepFactor = internal_collision_manager::s_fSweepStepFactor;
+    switch (_oCollider.GetType())
+    {
+      case collision::EColliderType::BOX_COLLIDER:
+      {
+        collision::CBoxCollider oProbe(static_cast<const collision::CBoxCollider&>(_oCollider));
+        const math::CVector3 v3HalfSize = oProbe.GetSize() * 0.5f;
+        const float fStep = math::Min(v3HalfSize.x, math::Min(v3HalfSize.y, v3HalfSize.z)) * fStepFactor;
+        return Sweep(oProbe, _oCollider.GetPos(), _v3Displacement, fDistance, fStep, _oHit_, eMask, &_oCollider);
+      }
+      case collision::EColliderType::SPHERE_COLLIDER:
+      {
+        collision::CSphereCollider oProbe(static_cast<const collision::CSphereCollider&>(_oCollider));
+        return Sweep(oProbe, _oCollider.GetPos(), _v3Displacement, fDistance, oProbe.GetRadius() * fStepFactor, _oHit_, eMask, &_oCollider);
+      }
+      case collision::EColliderType::CAPSULE_COLLIDER:
+      {
+        collision::CCapsuleCollider oProbe(static_cast<const collision::CCapsuleCollider&>(_oCollider));
+        return Sweep(oProbe, _oCollider.GetPos(), _v3Displacement, fDistance, oProbe.GetRadius() * fStepFactor, _oHit_, eMask, &_oCollider);
+      }
+      default: return false;
+    }
+  }
+  // ------------------------------------
+  bool CCollisionManager::RaycastClosest(const physics::CRay& _oRaycast, float _fMaxDistance, collision::TQueryHit& _oHit_, ECollisionMask _eMask)
+  {
+    // Broad-phase: only colliders whose bounds are crossed by the ray
+    m_pBroadPhase->QueryRay(_oRaycast, _fMaxDistance, m_lstQueryColliders);
+    internal_collision_manager::SortByID(m_lstQueryColliders);
+
     bool bHit = false;
     float fClosestDistance = _fMaxDistance;
-    for (uint32_t uI = 0; uI < m_lstColliders.GetCurrentSize(); ++uI)
+    for (collision::CCollider* pCollider : m_lstQueryColliders)
     {
-      collision::CCollider* pCollider = m_lstColliders[uI];
-      const collision::ECollisionMask& eCollMask = pCollider->GetCollisionMask();
+      const collision::ECollisionMask& eCollMask = m_oColliderData.Masks[pCollider->m_uDenseIdx];
       if ((eCollMask & _eMask) == 0)
       {
         continue;
@@ -126,37 +469,317 @@ namespace collision
       if (bIntersect && bCorrectDist)
       {
         bHit = true;
-        oHitEvent_ = oHitEvent;
+        _oHit_.HitEvent = oHitEvent;
+        _oHit_.Collider = pCollider;
         fClosestDistance = oHitEvent.Distance;
       }
     }
     return bHit;
   }
   // ------------------------------------
-  bool CCollisionManager::RaycastAll(const physics::CRay& _oRaycast, float _fMaxDistance, std::vector<THitEvent>& _lstOutHits_, ECollisionMask _eMask)
+  uint32_t CCollisionManager::Overlap(const collision::CCollider& _oProbe, collision::CCollider** _pColliders_, uint32_t _uMaxColliders, ECollisionMask _eMask)
   {
-    _lstOutHits_.clear();
-    for (uint32_t uI = 0; uI < m_lstColliders.GetCurrentSize(); ++uI)
+    // Broad-phase: only colliders whose bounds overlap the probe bounds
+    m_pBroadPhase->QueryAABB(_oProbe.GetBoundingBox(), m_lstQueryColliders);
+    internal_collision_manager::SortByID(m_lstQueryColliders);
+
+    uint32_t uCount = 0;
+    for (collision::CCollider* pCollider : m_lstQueryColliders)
     {
-      collision::CCollider* pCollider = m_lstColliders[uI];
-      if ((pCollider->GetCollisionMask() & _eMask) == 0)
+      if (uCount >= _uMaxColliders)
+      {
+        break;
+      }
+      if ((m_oColliderData.Masks[pCollider->m_uDenseIdx] & _eMask) == 0)
       {
         continue;
       }
 
       collision::THitEvent oHitEvent = collision::THitEvent();
-      bool bIntersect = pCollider->IntersectRay(_oRaycast, oHitEvent, _fMaxDistance);
-      bool bCorrectDist = oHitEvent.Distance <= _fMaxDistance;
-      if (bIntersect && bCorrectDist)
+      if (collision::CNarrowPhase::CheckPair(&_oProbe, pCollider, oHitEvent))
       {
-        _lstOutHits_.emplace_back(oHitEvent);
+        _pColliders_[uCount++] = pCollider;
       }
     }
-    return _lstOutHits_.size() > 0;
+    return uCount;
+  }
+  // ------------------------------------
+  bool CCollisionManager::Sweep(collision::CCollider& _oProbe_, const math::CVector3& _v3Origin, const math::CVector3& _v3Dir, float _fMaxDistance, float _fStep, collision::TQueryHit& _oHit_, ECollisionMask _eMask, const collision::CCollider* _pSource)
+  {
+    const math::CVector3 v3Dir = math::CVector3::Normalize(_v3Dir);
+    _fStep = math::Max(_fStep, internal_collision_manager::s_fMinSweepStep);
+
+    // Broad-phase: bounds of the whole sweep
+    collision::CAABB oSweepAABB = _oProbe_.GetBoundingBox();
+    const math::CVector3 v3Offset = v3Dir * _fMaxDistance;
+    const math::CVector3 v3Min = oSweepAABB.GetMin();
+    const math::CVector3 v3Max = oSweepAABB.GetMax();
+    oSweepAABB.SetMin(math::CVector3(math::Min(v3Min.x, v3Min.x + v3Offset.x), math::Min(v3Min.y, v3Min.y + v3Offset.y), math::Min(v3Min.z, v3Min.z + v3Offset.z)));
+    oSweepAABB.SetMax(math::CVector3(math::Max(v3Max.x, v3Max.x + v3Offset.x), math::Max(v3Max.y, v3Max.y + v3Offset.y), math::Max(v3Max.z, v3Max.z + v3Offset.z)));
+    m_pBroadPhase->QueryAABB(oSweepAABB, m_lstQueryColliders);
+    internal_collision_manager::SortByID(m_lstQueryColliders);
+
+    bool bHit = false;
+    float fClosestDistance = _fMaxDistance;
+    for (collision::CCollider* pCollider : m_lstQueryColliders)
+    {
+      if ((m_oColliderData.Masks[pCollider->m_uDenseIdx] & _eMask) == 0)
+      {
+        continue;
+      }
+      // Continuous collision of a registered collider: itself, the moving colliders and the triggers are skipped
+      if (_pSource && (pCollider == _pSource || !internal_collision_manager::IsFrozen(pCollider) || pCollider->IsTrigger()))
+      {
+        continue;
+      }
+
+      // Step along the sweep (steps under the probe radius, the probe cannot skip a collider)
+      collision::THitEvent oHitEvent = collision::THitEvent();
+      float fPrevDistance = 0.0f;
+      float fDistance = 0.0f;
+      bool bCandidateHit = false;
+      while (fDistance <= fClosestDistance)
+      {
+        _oProbe_.SetPos(_v3Origin + (v3Dir * fDistance));
+        _oProbe_.RecalculateCollider();
+        if (collision::CNarrowPhase::CheckPair(&_oProbe_, pCollider, oHitEvent))
+        {
+          bCandidateHit = true;
+          break;
+        }
+        if (fDistance >= fClosestDistance)
+        {
+          break;
+        }
+        fPrevDistance = fDistance;
+        fDistance = math::Min(fDistance + _fStep, fClosestDistance);
+      }
+      if (!bCandidateHit)
+      {
+        continue;
+      }
+
+      // Overlapped at the start: only a motion into the candidate is a hit, a body sliding along the floor (or
+      // leaving it) keeps looking for the walls ahead
+      if (fDistance <= 0.0f && math::CVector3::Normalize(oHitEvent.Normal).Dot(v3Dir) >= -internal_collision_manager::s_fSweepSlideTolerance)
+      {
+        continue;
+      }
+
+      // Refine the first contact between the last free step and the hit
+      for (uint32_t uIteration = 0; uIteration < internal_collision_manager::s_uSweepIterations && fDistance > 0.0f; ++uIteration)
+      {
+        float fMidDistance = (fPrevDistance + fDistance) * 0.5f;
+        _oProbe_.SetPos(_v3Origin + (v3Dir * fMidDistance));
+        _oProbe_.RecalculateCollider();
+
+        collision::THitEvent oMidHitEvent = collision::THitEvent();
+        if (collision::CNarrowPhase::CheckPair(&_oProbe_, pCollider, oMidHitEvent))
+        {
+          fDistance = fMidDistance;
+          oHitEvent = oMidHitEvent;
+        }
+        else
+        {
+          fPrevDistance = fMidDistance;
+        }
+      }
+
+      bHit = true;
+      fClosestDistance = fDistance;
+      _oHit_.Collider = pCollider;
+      _oHit_.HitEvent = oHitEvent;
+      _oHit_.HitEvent.Distance = fDistance;
+      _oHit_.HitEvent.Object = m_oColliderData.Owners[pCollider->m_uDenseIdx];
+    }
+    return bHit;
+  }
+  // ------------------------------------
+  void CCollisionManager::SyncColliderData()
+  {
+    // Copy the last collider state into the dense arrays, only moved colliders are pushed to the broad-phase
+    for (size_t tIndex = 0; tIndex < m_oColliderData.GetSize(); ++tIndex)
+    {
+      collision::CCollider* pCollider = m_oColliderData.Colliders[tIndex].get();
+
+      const collision::ECollisionMask& eLayers = pCollider->GetCollisionMask();
+      if (eLayers != m_oColliderData.Masks[tIndex] || m_bLayerMatrixDirty)
+      {
+        // Pairs filtered by the layer matrix appear or disappear
+        m_oColliderData.Masks[tIndex] = eLayers;
+        m_pBroadPhase->SetProxyLayers(m_oColliderData.ProxyIDs[tIndex], static_cast<uint32_t>(eLayers), ComputeLayerFilter(eLayers));
+        pCollider->m_uLastMovedFrame = m_uFrameStamp;
+      }
+
+      bool bStatic = internal_collision_manager::IsFrozen(pCollider);
+      if (bStatic != m_oColliderData.Statics[tIndex])
+      {
+        // Pairs with other static (or sleeping) colliders appear or disappear
+        m_oColliderData.Statics[tIndex] = bStatic;
+        m_pBroadPhase->SetProxyStatic(m_oColliderData.ProxyIDs[tIndex], bStatic);
+        pCollider->m_uLastMovedFrame = m_uFrameStamp;
+      }
+
+      if (pCollider->IsTrigger() != m_oColliderData.Triggers[tIndex])
+      {
+        // Pairs switch between contacts and overlaps
+        m_oColliderData.Triggers[tIndex] = pCollider->IsTrigger();
+        pCollider->m_uLastMovedFrame = m_uFrameStamp;
+      }
+
+      if (internal_collision_manager::HasMoved(m_oColliderData.AABBs[tIndex], pCollider->GetBoundingBox(), m_oColliderData.Transforms[tIndex], pCollider->GetTransform()))
+      {
+        m_oColliderData.AABBs[tIndex] = pCollider->GetBoundingBox();
+        m_oColliderData.Transforms[tIndex] = pCollider->GetTransform();
+        m_pBroadPhase->MoveProxy(m_oColliderData.ProxyIDs[tIndex], m_oColliderData.AABBs[tIndex]);
+        pCollider->m_uLastMovedFrame = m_uFrameStamp;
+      }
+    }
+    m_bLayerMatrixDirty = false;
+  }
+  // ------------------------------------
+  void CCollisionManager::SetLayerCollision(collision::ECollisionMask _eLayersA, collision::ECollisionMask _eLayersB, bool _bCollide)
+  {
+    const uint32_t uLayersA = static_cast<uint32_t>(_eLayersA);
+    const uint32_t uLayersB = static_cast<uint32_t>(_eLayersB);
+    for (uint32_t uLayer = 0; uLayer < s_uLayerCount; ++uLayer)
+    {
+      // Both rows, the matrix stays symmetric
+      const uint32_t uLayerBit = 1u << uLayer;
+      if (uLayersA & uLayerBit)
+      {
+        m_lstLayerMatrix[uLayer] = _bCollide ? (m_lstLayerMatrix[uLayer] | uLayersB) : (m_lstLayerMatrix[uLayer] & ~uLayersB);
+      }
+      if (uLayersB & uLayerBit)
+      {
+        m_lstLayerMatrix[uLayer] = _bCollide ? (m_lstLayerMatrix[uLayer] | uLayersA) : (m_lstLayerMatrix[uLayer] & ~uLayersA);
+      }
+    }
+
+    // Proxies are refreshed on the next update
+    m_bLayerMatrixDirty = true;
+  }
+  // ------------------------------------
+  bool CCollisionManager::GetLayerCollision(collision::ECollisionMask _eLayersA, collision::ECollisionMask _eLayersB) const
+  {
+    return (ComputeLayerFilter(_eLayersA) & static_cast<uint32_t>(_eLayersB)) != 0;
+  }
+  // ------------------------------------
+  uint32_t CCollisionManager::ComputeLayerFilter(collision::ECollisionMask _eLayers) const
+  {
+    // Layers that can collide with any of the given layers
+    uint32_t uLayerFilter = 0;
+    const uint32_t uLayers = static_cast<uint32_t>(_eLayers);
+    for (uint32_t uLayer = 0; uLayer < s_uLayerCount; ++uLayer)
+    {
+      if (uLayers & (1u << uLayer))
+      {
+        uLayerFilter |= m_lstLayerMatrix[uLayer];
+      }
+    }
+    return uLayerFilter;
+  }
+  // ------------------------------------
+  void CCollisionManager::DispatchEvents()
+  {
+    m_bDispatchingEvents = true;
+    for (const TCollisionEvent& rEvent : m_lstEvents)
+    {
+      collision::CCollider* pCollider = rEvent.ColliderA;
+      collision::CCollider* pTargetCollider = rEvent.ColliderB;
+      collision::THitEvent oHitEvent = rEvent.HitEvent;
+
+      // Notify to current collider
+      if (!pCollider->m_bPendingDestroy && !pTargetCollider->m_bPendingDestroy)
+      {
+        oHitEvent.Object = m_oColliderData.Owners[pTargetCollider->m_uDenseIdx];
+        switch (rEvent.Type)
+        {
+          case ECollisionEvent::ENTER: pCollider->m_oOnCollisionEnter(oHitEvent); break;
+          case ECollisionEvent::STAY: pCollider->m_oOnCollisionStay(oHitEvent); break;
+          case ECollisionEvent::EXIT: pCollider->m_oOnCollisionExit(oHitEvent); break;
+        }
+      }
+
+      // Notification to target collider (the first handler can destroy any of them)
+      if (!pCollider->m_bPendingDestroy && !pTargetCollider->m_bPendingDestroy)
+      {
+        oHitEvent.Normal *= -1.0f;
+        oHitEvent.Object = m_oColliderData.Owners[pCollider->m_uDenseIdx];
+        switch (rEvent.Type)
+        {
+          case ECollisionEvent::ENTER: pTargetCollider->m_oOnCollisionEnter(oHitEvent); break;
+          case ECollisionEvent::STAY: pTargetCollider->m_oOnCollisionStay(oHitEvent); break;
+          case ECollisionEvent::EXIT: pTargetCollider->m_oOnCollisionExit(oHitEvent); break;
+        }
+      }
+    }
+    m_bDispatchingEvents = false;
+
+    for (collision::CCollider* pCollider : m_lstPendingDestroy)
+    {
+      RemoveCollider(pCollider);
+    }
+    m_lstPendingDestroy.clear();
   }
   // ------------------------------------
   void CCollisionManager::Clean()
   {
-    m_lstColliders.Clear();
+    m_lstContacts.clear();
+    m_lstCurrentContacts.clear();
+    m_lstEvents.clear();
+    m_lstPendingDestroy.clear();
+    m_oColliderData.Clear();
+  }
+  // ------------------------------------
+  uint32_t CCollisionManager::TColliderData::Add(std::unique_ptr<collision::CCollider> _pCollider)
+  {
+    AABBs.emplace_back(_pCollider->GetBoundingBox());
+    Transforms.emplace_back(_pCollider->GetTransform());
+    Masks.emplace_back(_pCollider->GetCollisionMask());
+    Statics.emplace_back(false);
+    Triggers.emplace_back(_pCollider->IsTrigger());
+    Owners.emplace_back(_pCollider->GetOwner());
+    ProxyIDs.emplace_back(0);
+    Colliders.emplace_back(std::move(_pCollider));
+    return static_cast<uint32_t>(Colliders.size() - 1);
+  }
+  // ------------------------------------
+  void CCollisionManager::TColliderData::Remove(uint32_t _uDenseIdx)
+  {
+    // Swap with the last one and pop
+    size_t tLastIdx = Colliders.size() - 1;
+    if (_uDenseIdx != tLastIdx)
+    {
+      Colliders[_uDenseIdx] = std::move(Colliders[tLastIdx]);
+      AABBs[_uDenseIdx] = AABBs[tLastIdx];
+      Transforms[_uDenseIdx] = Transforms[tLastIdx];
+      Masks[_uDenseIdx] = Masks[tLastIdx];
+      Statics[_uDenseIdx] = Statics[tLastIdx];
+      Triggers[_uDenseIdx] = Triggers[tLastIdx];
+      Owners[_uDenseIdx] = Owners[tLastIdx];
+      ProxyIDs[_uDenseIdx] = ProxyIDs[tLastIdx];
+    }
+
+    Colliders.pop_back();
+    AABBs.pop_back();
+    Transforms.pop_back();
+    Masks.pop_back();
+    Statics.pop_back();
+    Triggers.pop_back();
+    Owners.pop_back();
+    ProxyIDs.pop_back();
+  }
+  // ------------------------------------
+  void CCollisionManager::TColliderData::Clear()
+  {
+    Colliders.clear();
+    AABBs.clear();
+    Transforms.clear();
+    Masks.clear();
+    Statics.clear();
+    Triggers.clear();
+    Owners.clear();
+    ProxyIDs.clear();
   }
 }
\ No newline at end of file
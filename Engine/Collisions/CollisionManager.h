@@ -1,38 +1,172 @@
 #pragma once
 #include "Engine/Collisions/Collider.h"
+#include "Engine/Collisions/BroadPhase/BroadPhase.h"
+#include "Engine/Collisions/NarrowPhase.h"
 #include "Engine/Utils/Ray.h"
 #include "Libs/Utils/Singleton.h"
-#include "Libs/Utils/FixedList.h"
-#include <unordered_map>
-#include <unordered_set>
+#include <memory>
 
 namespace collision
 {
+  struct TQueryHit
+  {
+    collision::THitEvent HitEvent = collision::THitEvent();
+    collision::CCollider* Collider = nullptr; // Null when nothing was hit
+  };
+
   class CCollisionManager : public utils::CSingleton<CCollisionManager>
   {
   public:
-    static const uint32_t s_uMaxColliders = 250;
-    typedef utils::CFixedList<collision::CCollider, s_uMaxColliders> TColliderList;
+    static constexpr uint32_t s_uLayerCount = 32u; // One bit of the collision mask per layer
+
+    struct TContact
+    {
+      uint64_t Key = 0; // Collider id A (high) + collider id B (low)
+      collision::CCollider* ColliderA = nullptr;
+      collision::CCollider* ColliderB = nullptr;
+      uint32_t StartFrame = 0; // Frame of the collision enter
+      collision::THitEvent HitEvent = collision::THitEvent(); // Seen from collider A, reused while both colliders are idle
+    };
+    typedef std::vector<TContact> TContactList;
+
+    // Collider poses, broad-phase and contact cache. Only valid for the colliders that existed when it was saved
+    struct TSnapshot
+    {
+      struct TColliderState
+      {
+        collision::CCollider* Collider = nullptr; // Dense order
+        uint32_t ProxyID = 0;
+        math::CTransform Transform = math::CTransform();
+        uint32_t LastMovedFrame = 0;
+        // Last synced data
+        collision::CAABB SyncedAABB = collision::CAABB();
+        math::CTransform SyncedTransform = math::CTransform();
+        collision::ECollisionMask SyncedMask = collision::ECollisionMask::DEFAULT;
+        bool SyncedStatic = false;
+        bool SyncedTrigger = false;
+      };
+
+      std::vector<TColliderState> Colliders;
+      std::unique_ptr<collision::CBroadPhase> BroadPhase = nullptr; // Same type as the saved one
+      TContactList Contacts;
+      uint32_t FrameStamp = 0;
+    };
 
   public:
-    CCollisionManager() {}
+    CCollisionManager();
     ~CCollisionManager() { Clean(); }
 
     void Update(float _fDeltaTime);
 
-    const TColliderList& GetColliderList() { return m_lstColliders; }
+    // Rebuilds the broad-phase with the current colliders
+    void SetBroadPhaseType(collision::EBroadPhaseType _eBroadPhaseType);
+    inline const collision::EBroadPhaseType& GetBroadPhaseType() const { return m_pBroadPhase->GetType(); }
+
+    // Layer interaction matrix (symmetric), every layer collides with every layer by default
+    void SetLayerCollision(collision::ECollisionMask _eLayersA, collision::ECollisionMask _eLayersB, bool _bCollide);
+    bool GetLayerCollision(collision::ECollisionMask _eLayersA, collision::ECollisionMask _eLayersB) const;
+
+    // Contacts of the last update (sorted by key)
+    inline const TContactList& GetContacts() const { return m_lstContacts; }
+
+    inline size_t GetColliderCount() const { return m_oColliderData.GetSize(); }
+    inline collision::CCollider* GetCollider(size_t _tIndex) const { return m_oColliderData.Colliders[_tIndex].get(); }
     collision::CCollider* CreateCollider(collision::EColliderType _eColliderType, void* _pOwner);
     void DestroyCollider(collision::CCollider*& _pCollider_);
 
+    // Rollback: the snapshot buffers are reused (no allocations once they have grown). The restore fails (nothing
+    // is restored) if colliders were created or destroyed, or the broad-phase type changed since the save.
+    // Colliders get back their poses, their owners have to follow them
+    void SaveSnapshot(TSnapshot& _rSnapshot_) const;
+    bool RestoreSnapshot(const TSnapshot& _rSnapshot);
+    bool IsSnapshotValid(const TSnapshot& _rSnapshot) const;
+
     bool Raycast(const physics::CRay& _oRaycast, float _fMaxDistance, THitEvent& _oHitEvent_, ECollisionMask _eMask = ECollisionMask::DEFAULT);
     bool RaycastAll(const physics::CRay& _oRaycast, float _fMaxDistance, std::vector<THitEvent>& _lstHits_, ECollisionMask _eMask = ECollisionMask::DEFAULT);
 
+    // Scene queries: results go to caller buffers, nothing is allocated once the internal lists have grown
+    uint32_t RaycastBatch(const physics::CRay* _pRays, uint32_t _uRayCount, float _fMaxDistance, collision::TQueryHit* _pHits_, ECollisionMask _eMask = ECollisionMask::DEFAULT);
+    uint32_t OverlapSphere(const math::CVector3& _v3Center, float _fRadius, collision::CCollider** _pColliders_, uint32_t _uMaxColliders, ECollisionMask _eMask = ECollisionMask::DEFAULT);
+    uint32_t OverlapBox(const math::CVector3& _v3Center, const math::CVector3& _v3Size, const math::CVector3& _v3Rot, collision::CCollider** _pColliders_, uint32_t _uMaxColliders, ECollisionMask _eMask = ECollisionMask::DEFAULT);
+    bool SweepSphere(const math::CVector3& _v3Origin, float _fRadius, const math::CVector3& _v3Dir, float _fMaxDistance, collision::TQueryHit& _oHit_, ECollisionMask _eMask = ECollisionMask::DEFAULT);
+    bool SweepCapsule(const math::CVector3& _v3Origin, float _fRadius, float _fHeight, const math::CVector3& _v3Rot, const math::CVector3& _v3Dir, float _fMaxDistance, collision::TQueryHit& _oHit_, ECollisionMask _eMask = ECollisionMask::DEFAULT);
+
+    // Continuous collision: first hit of the collider moved by the displacement, only static and sleeping colliders
+    // (layer matrix) are tested. The hit distance is measured along the displacement
+    bool SweepCollider(const collision::CCollider& _oCollider, const math::CVector3& _v3Displacement, collision::TQueryHit& _oHit_);
+
   private:
     void Clean();
+    void SyncColliderData();
+    void KeepOrExitContact(const TContact& _rContact);
+    uint32_t ComputeLayerFilter(collision::ECollisionMask _eLayers) const;
+
+    bool RaycastClosest(const physics::CRay& _oRaycast, float _fMaxDistance, collision::TQueryHit& _oHit_, ECollisionMask _eMask);
+    uint32_t Overlap(const collision::CCollider& _oProbe, collision::CCollider** _pColliders_, uint32_t _uMaxColliders, ECollisionMask _eMask);
+    bool Sweep(collision::CCollider& _oProbe_, const math::CVector3& _v3Origin, const math::CVector3& _v3Dir, float _fMaxDistance, float _fStep, collision::TQueryHit& _oHit_, ECollisionMask _eMask, const collision::CCollider* _pSource = nullptr);
+    void RemoveCollider(collision::CCollider* _pCollider);
+    void DispatchEvents();
+
+  private:
+    // Dense collider data (structure of arrays), each collider keeps its index
+    struct TColliderData
+    {
+      std::vector<std::unique_ptr<collision::CCollider>> Colliders; // Stable addresses (handles)
+      std::vector<collision::CAABB> AABBs;
+      std::vector<math::CTransform> Transforms;
+      std::vector<collision::ECollisionMask> Masks; // Layers of the last step, like the broad-phase (query filters)
+      std::vector<bool> Statics;
+      std::vector<bool> Triggers;
+      std::vector<void*> Owners;
+      std::vector<uint32_t> ProxyIDs;
+
+      inline size_t GetSize() const { return Colliders.size(); }
+      uint32_t Add(std::unique_ptr<collision::CCollider> _pCollider);
+      void Remove(uint32_t _uDenseIdx);
+      void Clear();
+    };
+
+    enum class ECollisionEvent : uint8_t
+    {
+      ENTER,
+      STAY,
+      EXIT
+    };
+
+    struct TCollisionEvent
+    {
+      ECollisionEvent Type = ECollisionEvent::ENTER;
+      collision::CCollider* ColliderA = nullptr;
+      collision::CCollider* ColliderB = nullptr;
+      collision::THitEvent HitEvent = collision::THitEvent(); // Seen from collider A
+    };
 
   private:
-    TColliderList m_lstColliders;
-    std::unordered_map<collision::CCollider*, std::unordered_set<collision::CCollider*>> m_dctHandleCollisions;
+    TColliderData m_oColliderData;
+    uint32_t m_uNextColliderID = 0;
+
+    // Broad-phase
+    std::unique_ptr<collision::CBroadPhase> m_pBroadPhase = nullptr;
+    collision::CBroadPhase::TPairList m_lstCollisionPairs;
+    collision::CBroadPhase::TColliderList m_lstQueryColliders;
+
+    // Layers each layer can collide with (applied in the broad-phase)
+    uint32_t m_lstLayerMatrix[s_uLayerCount];
+    bool m_bLayerMatrixDirty = false;
+
+    // Narrow-phase
+    collision::CNarrowPhase m_oNarrowPhase;
+    collision::CNarrowPhase::TResultList m_lstPairResults;
+
+    // Contact cache (sorted by key)
+    TContactList m_lstContacts;
+    TContactList m_lstCurrentContacts;
+    uint32_t m_uFrameStamp = 0;
+
+    // Events of the step (pair key order), dispatched once the contacts are up to date
+    std::vector<TCollisionEvent> m_lstEvents;
+    std::vector<collision::CCollider*> m_lstPendingDestroy;
+    bool m_bDispatchingEvents = false;
   };
 }
 
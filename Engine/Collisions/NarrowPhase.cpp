@@ -0,0 +1,512 @@
+#include "NarrowPhase.h"
+#include "Engine/Collisions/BoxCollider.h"
+#include "Engine/Collisions/SphereCollider.h"
+#include "Engine/Collisions/CapsuleCollider.h"
+#include "Libs/Utils/WorkerPool.h"
+#include <cassert>
+#include <xmmintrin.h>
+#include <immintrin.h>
+
+namespace collision
+{
+  namespace internal_narrow_phase
+  {
+    // Symmetric, (A, B) and (B, A) share the bucket
+    static constexpr uint32_t s_lstShapePairs[3][3] =
+    {
+      { 0, 3, 4 },
+      { 3, 2, 5 },
+      { 4, 5, 6 }
+    };
+
+    inline void StoreResult(uint32_t _uPairIdx, bool _bFlip, bool _bHit, const collision::THitEvent& _oHitEvent, CNarrowPhase::TResultList& _lstResults_)
+    {
+      collision::TPairResult& rResult = _lstResults_[_uPairIdx];
+      rResult.Hit = _bHit;
+      if (_bHit)
+      {
+        rResult.HitEvent = _oHitEvent;
+        if (_bFlip)
+        {
+          rResult.HitEvent.Normal *= -1.0f;
+        }
+      }
+    }
+
+    inline uint32_t GetValidLanesMask(uint32_t _uIndex, uint32_t _uEnd)
+    {
+      uint32_t uValidLanes = _uEnd - _uIndex;
+      return uValidLanes >= 4 ? 0xFu : ((1u << uValidLanes) - 1u);
+    }
+
+    static constexpr uint32_t s_uSegmentBoxIterations = 24u; // Golden section steps (0.618^24 ~ 1e-5 of the segment)
+    static constexpr float s_fGoldenRatio = 0.618034f;
+
+    // Box as center + axes + half size (world axes in AABB mode)
+    struct TBox
+    {
+      math::CVector3 Center = math::CVector3::Zero;
+      math::CVector3 Axes[3] = { math::CVector3::Right, math::CVector3::Up, math::CVector3::Forward };
+      math::CVector3 HalfSize = math::CVector3::Zero;
+    };
+
+    inline TBox GetBox(const CBoxCollider* _pBox)
+    {
+      TBox oBox;
+      oBox.Center = _pBox->GetCenter();
+      oBox.HalfSize = _pBox->GetHalfSize();
+      if (_pBox->IsOBB())
+      {
+        oBox.Axes[0] = _pBox->GetRightAxis();
+        oBox.Axes[1] = _pBox->GetUpAxis();
+        oBox.Axes[2] = _pBox->GetForwardAxis();
+      }
+      return oBox;
+    }
+
+    inline math::CVector3 ClosestPtBox(const TBox& _rBox, const math::CVector3& _v3Point)
+    {
+      const math::CVector3 v3Offset = _v3Point - _rBox.Center;
+      math::CVector3 v3Closest = _rBox.Center;
+      for (uint32_t uAxis = 0; uAxis < 3; ++uAxis)
+      {
+        v3Closest += _rBox.Axes[uAxis] * math::Clamp(v3Offset.Dot(_rBox.Axes[uAxis]), -_rBox.HalfSize[uAxis], _rBox.HalfSize[uAxis]);
+      }
+      return v3Closest;
+    }
+
+    inline float SqDistPointBox(const TBox& _rBox, const math::CVector3& _v3Point)
+    {
+      return (_v3Point - ClosestPtBox(_rBox, _v3Point)).GetSqrDist();
+    }
+
+    inline float ProjectBox(const TBox& _rBox, const math::CVector3& _v3Axis)
+    {
+      return (std::fabs(_rBox.Axes[0].Dot(_v3Axis)) * _rBox.HalfSize.x) + (std::fabs(_rBox.Axes[1].Dot(_v3Axis)) * _rBox.HalfSize.y) + (std::fabs(_rBox.Axes[2].Dot(_v3Axis)) * _rBox.HalfSize.z);
+    }
+
+    bool OverlapBoxBox(const TBox& _rBoxA, const TBox& _rBoxB)
+    {
+      // Separating axis test: 3 + 3 face normals + 9 edge crosses (parallel edges are skipped)
+      const math::CVector3 v3Offset = _rBoxB.Center - _rBoxA.Center;
+      auto IsSeparated = [&](const math::CVector3& _v3Axis)
+      {
+        return std::fabs(v3Offset.Dot(_v3Axis)) > ProjectBox(_rBoxA, _v3Axis) + ProjectBox(_rBoxB, _v3Axis);
+      };
+
+      for (uint32_t uAxis = 0; uAxis < 3; ++uAxis)
+      {
+        if (IsSeparated(_rBoxA.Axes[uAxis]) || IsSeparated(_rBoxB.Axes[uAxis]))
+        {
+          return false;
+        }
+      }
+      for (uint32_t uAxisA = 0; uAxisA < 3; ++uAxisA)
+      {
+        for (uint32_t uAxisB = 0; uAxisB < 3; ++uAxisB)
+        {
+          const math::CVector3 v3Axis = _rBoxA.Axes[uAxisA].Cross(_rBoxB.Axes[uAxisB]);
+          if (v3Axis.GetSqrDist() > math::s_fEpsilon6 && IsSeparated(v3Axis))
+          {
+            return false;
+          }
+        }
+      }
+      return true;
+    }
+
+    bool OverlapBoxSegment(const TBox& _rBox, const math::CVector3& _v3Start, const math::CVector3& _v3End, float _fRadius)
+    {
+      // The distance to a convex shape is convex along the segment: golden section search of its minimum
+      const float fSqrRadius = _fRadius * _fRadius;
+      const math::CVector3 v3Dir = _v3End - _v3Start;
+      float fMin = 0.0f, fMax = 1.0f;
+      float fLeft = fMax - ((fMax - fMin) * s_fGoldenRatio);
+      float fRight = fMin + ((fMax - fMin) * s_fGoldenRatio);
+      float fDistLeft = SqDistPointBox(_rBox, _v3Start + (v3Dir * fLeft));
+      float fDistRight = SqDistPointBox(_rBox, _v3Start + (v3Dir * fRight));
+      for (uint32_t uIteration = 0; uIteration < s_uSegmentBoxIterations; ++uIteration)
+      {
+        if (math::Min(fDistLeft, fDistRight) <= fSqrRadius)
+        {
+          return true;
+        }
+
+        if (fDistLeft < fDistRight)
+        {
+          fMax = fRight;
+          fRight = fLeft;
+          fDistRight = fDistLeft;
+          fLeft = fMax - ((fMax - fMin) * s_fGoldenRatio);
+          fDistLeft = SqDistPointBox(_rBox, _v3Start + (v3Dir * fLeft));
+        }
+        else
+        {
+          fMin = fLeft;
+          fLeft = fRight;
+          fDistLeft = fDistRight;
+          fRight = fMin + ((fMax - fMin) * s_fGoldenRatio);
+          fDistRight = SqDistPointBox(_rBox, _v3Start + (v3Dir * fRight));
+        }
+      }
+
+      // The minimum can be on the end points
+      return math::Min(fDistLeft, fDistRight) <= fSqrRadius || SqDistPointBox(_rBox, _v3Start) <= fSqrRadius || SqDistPointBox(_rBox, _v3End) <= fSqrRadius;
+    }
+
+    inline void ResizeLanes(std::vector<float>* _pLanes, uint32_t _uLaneCount, size_t _tSize, size_t _tLaneWidth)
+    {
+      // Padded to the lane width, loads never read out of bounds
+      size_t tPaddedSize = ((_tSize + _tLaneWidth - 1) / _tLaneWidth) * _tLaneWidth;
+      for (uint32_t uLane = 0; uLane < _uLaneCount; ++uLane)
+      {
+        _pLanes[uLane].resize(tPaddedSize, 0.0f);
+      }
+    }
+  }
+  // ------------------------------------
+  template<typename TKernel>
+  void CNarrowPhase::ExecuteBucket(EBucket _eBucket, uint32_t _uBegin, uint32_t _uEnd, TKernel&& _oKernel, TResultList& _lstResults_)
+  {
+    const std::vector<TBucketEntry>& lstEntries = m_lstBuckets[_eBucket];
+    for (uint32_t uIndex = _uBegin; uIndex < _uEnd; ++uIndex)
+    {
+      const TBucketEntry& rEntry = lstEntries[uIndex];
+      collision::THitEvent oHitEvent = collision::THitEvent();
+      bool bHit = _oKernel(rEntry.ColliderA, rEntry.ColliderB, oHitEvent);
+      internal_narrow_phase::StoreResult(rEntry.PairIdx, rEntry.Flip, bHit, oHitEvent, _lstResults_);
+    }
+  }
+  // ------------------------------------
+  void CNarrowPhase::Execute(const collision::CBroadPhase::TPairList& _lstPairs, uint32_t _uFrameStamp, TResultList& _lstResults_)
+  {
+    _lstResults_.clear();
+    _lstResults_.resize(_lstPairs.size());
+    FillBuckets(_lstPairs, _uFrameStamp, _lstResults_);
+    FillJobs();
+
+    // Every job writes only the results of its own pairs, no sort or merge is needed afterwards
+    utils::CWorkerPool::GetInstance()->ParallelFor(static_cast<uint32_t>(m_lstJobs.size()), 1u, [&](uint32_t _uBegin, uint32_t _uEnd, uint32_t /*_uWorkerIdx*/)
+    {
+      for (uint32_t uJob = _uBegin; uJob < _uEnd; ++uJob)
+      {
+        ExecuteJob(m_lstJobs[uJob], _lstResults_);
+      }
+    });
+  }
+  // ------------------------------------
+  bool CNarrowPhase::CheckPair(const collision::CCollider* _pA, const collision::CCollider* _pB, collision::THitEvent& _oHitEvent_)
+  {
+    const collision::EColliderType& eTypeA = _pA->GetType();
+    const collision::EColliderType& eTypeB = _pB->GetType();
+#ifdef _DEBUG
+    assert(eTypeA != EColliderType::INVALID && eTypeB != EColliderType::INVALID);
+#endif
+
+    // Same order as the buckets
+    const bool bFlip = eTypeA > eTypeB;
+    const collision::CCollider* pFirst = bFlip ? _pB : _pA;
+    const collision::CCollider* pSecond = bFlip ? _pA : _pB;
+
+    bool bHit = false;
+    switch (static_cast<EBucket>(internal_narrow_phase::s_lstShapePairs[static_cast<uint32_t>(eTypeA)][static_cast<uint32_t>(eTypeB)]))
+    {
+      case EBucket::AABB_AABB:
+      {
+        const CBoxCollider* pBox = static_cast<const CBoxCollider*>(pFirst);
+        bHit = pBox->IsOBB() ? CheckOBBOBB(pFirst, pSecond, _oHitEvent_) : pBox->CheckAABBCollision(static_cast<const CBoxCollider*>(pSecond), _oHitEvent_);
+        break;
+      }
+      case EBucket::SPHERE_SPHERE:
+      {
+        const CSphereCollider* pSphere = static_cast<const CSphereCollider*>(pFirst);
+        bHit = pSphere->CheckSphereCollision(static_cast<const CSphereCollider*>(pSecond), _oHitEvent_);
+        break;
+      }
+      case EBucket::BOX_SPHERE: bHit = CheckBoxSphere(pFirst, pSecond, _oHitEvent_); break;
+      case EBucket::BOX_CAPSULE: bHit = CheckBoxCapsule(pFirst, pSecond, _oHitEvent_); break;
+      case EBucket::SPHERE_CAPSULE: bHit = CheckSphereCapsule(pFirst, pSecond, _oHitEvent_); break;
+      case EBucket::CAPSULE_CAPSULE: bHit = CheckCapsuleCapsule(pFirst, pSecond, _oHitEvent_); break;
+      default: break;
+    }
+
+    if (bHit && bFlip)
+    {
+      _oHitEvent_.Normal *= -1.0f;
+    }
+    return bHit;
+  }
+  // ------------------------------------
+  void CNarrowPhase::FillBuckets(const collision::CBroadPhase::TPairList& _lstPairs, uint32_t _uFrameStamp, TResultList& _lstResults_)
+  {
+    for (std::vector<TBucketEntry>& lstBucket : m_lstBuckets)
+    {
+      lstBucket.clear();
+    }
+
+    for (uint32_t uIndex = 0; uIndex < static_cast<uint32_t>(_lstPairs.size()); ++uIndex)
+    {
+      const collision::TCollisionPair& rPair = _lstPairs[uIndex];
+      if (rPair.ColliderA->GetLastMovedFrame() != _uFrameStamp && rPair.ColliderB->GetLastMovedFrame() != _uFrameStamp)
+      {
+        _lstResults_[uIndex].Cached = true;
+        continue;
+      }
+
+      const collision::EColliderType& eTypeA = rPair.ColliderA->GetType();
+      const collision::EColliderType& eTypeB = rPair.ColliderB->GetType();
+#ifdef _DEBUG
+      assert(eTypeA != EColliderType::INVALID && eTypeB != EColliderType::INVALID);
+#endif
+
+      TBucketEntry oEntry;
+      oEntry.Flip = eTypeA > eTypeB;
+      oEntry.ColliderA = oEntry.Flip ? rPair.ColliderB : rPair.ColliderA;
+      oEntry.ColliderB = oEntry.Flip ? rPair.ColliderA : rPair.ColliderB;
+      oEntry.PairIdx = uIndex;
+
+      // The OBB mode of the first box decides the test (same as CBoxCollider::CheckCollision)
+      EBucket eBucket = static_cast<EBucket>(internal_narrow_phase::s_lstShapePairs[static_cast<uint32_t>(eTypeA)][static_cast<uint32_t>(eTypeB)]);
+      if (rPair.ColliderA->IsTrigger() || rPair.ColliderB->IsTrigger())
+      {
+        eBucket = EBucket::TRIGGER;
+      }
+      else if (eBucket == EBucket::AABB_AABB && static_cast<const CBoxCollider*>(oEntry.ColliderA)->IsOBB())
+      {
+        eBucket = EBucket::OBB_OBB;
+      }
+      m_lstBuckets[eBucket].emplace_back(oEntry);
+    }
+  }
+  // ------------------------------------
+  void CNarrowPhase::FillJobs()
+  {
+    m_lstJobs.clear();
+    for (uint32_t uBucket = 0; uBucket < EBucket::COUNT; ++uBucket)
+    {
+      const uint32_t uSize = static_cast<uint32_t>(m_lstBuckets[uBucket].size());
+      for (uint32_t uBegin = 0; uBegin < uSize; uBegin += s_uBatchSize)
+      {
+        TJob oJob;
+        oJob.Bucket = static_cast<EBucket>(uBucket);
+        oJob.Begin = uBegin;
+        oJob.End = math::Min(uBegin + s_uBatchSize, uSize);
+        m_lstJobs.emplace_back(oJob);
+      }
+    }
+
+    // Lanes are shared, every job only touches its own range
+    internal_narrow_phase::ResizeLanes(m_lstAABBLanes, s_uAABBLaneCount, m_lstBuckets[EBucket::AABB_AABB].size(), s_uLaneWidth);
+    internal_narrow_phase::ResizeLanes(m_lstSphereLanes, s_uSphereLaneCount, m_lstBuckets[EBucket::SPHERE_SPHERE].size(), s_uLaneWidth);
+  }
+  // ------------------------------------
+  void CNarrowPhase::ExecuteJob(const TJob& _rJob, TResultList& _lstResults_)
+  {
+    switch (_rJob.Bucket)
+    {
+      case EBucket::AABB_AABB: ExecuteAABBAABB(_rJob.Begin, _rJob.End, _lstResults_); break;
+      case EBucket::SPHERE_SPHERE: ExecuteSphereSphere(_rJob.Begin, _rJob.End, _lstResults_); break;
+      case EBucket::OBB_OBB: ExecuteBucket(_rJob.Bucket, _rJob.Begin, _rJob.End, &CNarrowPhase::CheckOBBOBB, _lstResults_); break;
+      case EBucket::BOX_SPHERE: ExecuteBucket(_rJob.Bucket, _rJob.Begin, _rJob.End, &CNarrowPhase::CheckBoxSphere, _lstResults_); break;
+      case EBucket::BOX_CAPSULE: ExecuteBucket(_rJob.Bucket, _rJob.Begin, _rJob.End, &CNarrowPhase::CheckBoxCapsule, _lstResults_); break;
+      case EBucket::SPHERE_CAPSULE: ExecuteBucket(_rJob.Bucket, _rJob.Begin, _rJob.End, &CNarrowPhase::CheckSphereCapsule, _lstResults_); break;
+      case EBucket::CAPSULE_CAPSULE: ExecuteBucket(_rJob.Bucket, _rJob.Begin, _rJob.End, &CNarrowPhase::CheckCapsuleCapsule, _lstResults_); break;
+      case EBucket::TRIGGER: ExecuteBucket(_rJob.Bucket, _rJob.Begin, _rJob.End, &CNarrowPhase::CheckOverlap, _lstResults_); break;
+      default: break;
+    }
+  }
+  // ------------------------------------
+  void CNarrowPhase::ExecuteAABBAABB(uint32_t _uBegin, uint32_t _uEnd, TResultList& _lstResults_)
+  {
+    const std::vector<TBucketEntry>& lstEntries = m_lstBuckets[EBucket::AABB_AABB];
+
+    // Gather: min A (0-2), max A (3-5), min B (6-8), max B (9-11)
+    for (uint32_t uIndex = _uBegin; uIndex < _uEnd; ++uIndex)
+    {
+      const CBoxCollider* pBoxA = static_cast<const CBoxCollider*>(lstEntries[uIndex].ColliderA);
+      const CBoxCollider* pBoxB = static_cast<const CBoxCollider*>(lstEntries[uIndex].ColliderB);
+      for (uint32_t uAxis = 0; uAxis < 3; ++uAxis)
+      {
+        m_lstAABBLanes[uAxis][uIndex] = pBoxA->GetMin()[uAxis];
+        m_lstAABBLanes[3 + uAxis][uIndex] = pBoxA->GetMax()[uAxis];
+        m_lstAABBLanes[6 + uAxis][uIndex] = pBoxB->GetMin()[uAxis];
+        m_lstAABBLanes[9 + uAxis][uIndex] = pBoxB->GetMax()[uAxis];
+      }
+    }
+
+    for (uint32_t uIndex = _uBegin; uIndex < _uEnd; uIndex += s_uLaneWidth)
+    {
+      // Overlap on every axis: min A <= max B && max A >= min B
+      __m128 vOverlap = _mm_castsi128_ps(_mm_set1_epi32(-1));
+      for (uint32_t uAxis = 0; uAxis < 3; ++uAxis)
+      {
+        __m128 vMinA = _mm_loadu_ps(&m_lstAABBLanes[uAxis][uIndex]);
+        __m128 vMaxA = _mm_loadu_ps(&m_lstAABBLanes[3 + uAxis][uIndex]);
+        __m128 vMinB = _mm_loadu_ps(&m_lstAABBLanes[6 + uAxis][uIndex]);
+        __m128 vMaxB = _mm_loadu_ps(&m_lstAABBLanes[9 + uAxis][uIndex]);
+        vOverlap = _mm_and_ps(vOverlap, _mm_and_ps(_mm_cmple_ps(vMinA, vMaxB), _mm_cmpge_ps(vMaxA, vMinB)));
+      }
+
+      uint32_t uMask = static_cast<uint32_t>(_mm_movemask_ps(vOverlap)) & internal_narrow_phase::GetValidLanesMask(uIndex, _uEnd);
+      for (uint32_t uLane = 0; uLane < s_uLaneWidth && (uIndex + uLane) < _uEnd; ++uLane)
+      {
+        const TBucketEntry& rEntry = lstEntries[uIndex + uLane];
+        collision::THitEvent oHitEvent = collision::THitEvent();
+
+        // Contact data only for the overlapping lanes
+        bool bHit = (uMask & (1u << uLane)) != 0;
+        if (bHit)
+        {
+          const CBoxCollider* pBoxA = static_cast<const CBoxCollider*>(rEntry.ColliderA);
+          bHit = pBoxA->CheckAABBCollision(static_cast<const CBoxCollider*>(rEntry.ColliderB), oHitEvent);
+        }
+        internal_narrow_phase::StoreResult(rEntry.PairIdx, rEntry.Flip, bHit, oHitEvent, _lstResults_);
+      }
+    }
+  }
+  // ------------------------------------
+  void CNarrowPhase::ExecuteSphereSphere(uint32_t _uBegin, uint32_t _uEnd, TResultList& _lstResults_)
+  {
+    const std::vector<TBucketEntry>& lstEntries = m_lstBuckets[EBucket::SPHERE_SPHERE];
+
+    // Gather: center + radius A (0-3), center + radius B (4-7)
+    for (uint32_t uIndex = _uBegin; uIndex < _uEnd; ++uIndex)
+    {
+      const CSphereCollider* pSphereA = static_cast<const CSphereCollider*>(lstEntries[uIndex].ColliderA);
+      const CSphereCollider* pSphereB = static_cast<const CSphereCollider*>(lstEntries[uIndex].ColliderB);
+      for (uint32_t uAxis = 0; uAxis < 3; ++uAxis)
+      {
+        m_lstSphereLanes[uAxis][uIndex] = pSphereA->GetCenter()[uAxis];
+        m_lstSphereLanes[4 + uAxis][uIndex] = pSphereB->GetCenter()[uAxis];
+      }
+      m_lstSphereLanes[3][uIndex] = pSphereA->GetRadius();
+      m_lstSphereLanes[7][uIndex] = pSphereB->GetRadius();
+    }
+
+    for (uint32_t uIndex = _uBegin; uIndex < _uEnd; uIndex += s_uLaneWidth)
+    {
+      __m128 vOffsetX = _mm_sub_ps(_mm_loadu_ps(&m_lstSphereLanes[0][uIndex]), _mm_loadu_ps(&m_lstSphereLanes[4][uIndex]));
+      __m128 vOffsetY = _mm_sub_ps(_mm_loadu_ps(&m_lstSphereLanes[1][uIndex]), _mm_loadu_ps(&m_lstSphereLanes[5][uIndex]));
+      __m128 vOffsetZ = _mm_sub_ps(_mm_loadu_ps(&m_lstSphereLanes[2][uIndex]), _mm_loadu_ps(&m_lstSphereLanes[6][uIndex]));
+      __m128 vRadiusSum = _mm_add_ps(_mm_loadu_ps(&m_lstSphereLanes[3][uIndex]), _mm_loadu_ps(&m_lstSphereLanes[7][uIndex]));
+
+      __m128 vSqrDist = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vOffsetX, vOffsetX), _mm_mul_ps(vOffsetY, vOffsetY)), _mm_mul_ps(vOffsetZ, vOffsetZ));
+      __m128 vHit = _mm_cmple_ps(vSqrDist, _mm_mul_ps(vRadiusSum, vRadiusSum));
+
+      // Contact data only for the overlapping lanes
+      uint32_t uMask = static_cast<uint32_t>(_mm_movemask_ps(vHit)) & internal_narrow_phase::GetValidLanesMask(uIndex, _uEnd);
+      for (uint32_t uLane = 0; uLane < s_uLaneWidth && (uIndex + uLane) < _uEnd; ++uLane)
+      {
+        const uint32_t uLaneIdx = uIndex + uLane;
+        const TBucketEntry& rEntry = lstEntries[uLaneIdx];
+        collision::THitEvent oHitEvent = collision::THitEvent();
+
+        bool bHit = (uMask & (1u << uLane)) != 0;
+        if (bHit)
+        {
+          math::CVector3 v3Center(m_lstSphereLanes[0][uLaneIdx], m_lstSphereLanes[1][uLaneIdx], m_lstSphereLanes[2][uLaneIdx]);
+          math::CVector3 v3Offset = v3Center - math::CVector3(m_lstSphereLanes[4][uLaneIdx], m_lstSphereLanes[5][uLaneIdx], m_lstSphereLanes[6][uLaneIdx]);
+          float fRadiusSum = m_lstSphereLanes[3][uLaneIdx] + m_lstSphereLanes[7][uLaneIdx];
+
+          // Same contact as CSphereCollider::CheckSphereCollision
+          oHitEvent.Normal = math::CVector3::Normalize(v3Offset);
+          oHitEvent.Depth = fRadiusSum - v3Offset.Magnitude();
+          oHitEvent.ImpactPoint = v3Center + (oHitEvent.Normal * m_lstSphereLanes[3][uLaneIdx]);
+        }
+        internal_narrow_phase::StoreResult(rEntry.PairIdx, rEntry.Flip, bHit, oHitEvent, _lstResults_);
+      }
+    }
+  }
+  // ------------------------------------
+  bool CNarrowPhase::CheckOBBOBB(const collision::CCollider* _pA, const collision::CCollider* _pB, collision::THitEvent& _oHitEvent_)
+  {
+    const CBoxCollider* pBox = static_cast<const CBoxCollider*>(_pA);
+    return pBox->CheckOBBCollision(static_cast<const CBoxCollider*>(_pB), _oHitEvent_);
+  }
+  // ------------------------------------
+  bool CNarrowPhase::CheckBoxSphere(const collision::CCollider* _pA, const collision::CCollider* _pB, collision::THitEvent& _oHitEvent_)
+  {
+    const CBoxCollider* pBox = static_cast<const CBoxCollider*>(_pA);
+    const CSphereCollider* pSphere = static_cast<const CSphereCollider*>(_pB);
+    return pBox->IsOBB() ? pBox->CheckOBBSphereCollision(pSphere, _oHitEvent_) : pBox->CheckSphereCollision(pSphere, _oHitEvent_);
+  }
+  // ------------------------------------
+  bool CNarrowPhase::CheckBoxCapsule(const collision::CCollider* _pA, const collision::CCollider* _pB, collision::THitEvent& _oHitEvent_)
+  {
+    const CBoxCollider* pBox = static_cast<const CBoxCollider*>(_pA);
+    const CCapsuleCollider* pCapsule = static_cast<const CCapsuleCollider*>(_pB);
+    bool bHit = pBox->IsOBB() ? pCapsule->CheckOBBCollision(pBox, _oHitEvent_) : pCapsule->CheckBoxCollision(pBox, _oHitEvent_);
+    _oHitEvent_.Normal *= -1.0f;
+    return bHit;
+  }
+  // ------------------------------------
+  bool CNarrowPhase::CheckSphereCapsule(const collision::CCollider* _pA, const collision::CCollider* _pB, collision::THitEvent& _oHitEvent_)
+  {
+    const CSphereCollider* pSphere = static_cast<const CSphereCollider*>(_pA);
+    const CCapsuleCollider* pCapsule = static_cast<const CCapsuleCollider*>(_pB);
+    bool bHit = pCapsule->CheckSphereCollision(pSphere, _oHitEvent_);
+    _oHitEvent_.Normal *= -1.0f;
+    return bHit;
+  }
+  // ------------------------------------
+  bool CNarrowPhase::CheckCapsuleCapsule(const collision::CCollider* _pA, const collision::CCollider* _pB, collision::THitEvent& _oHitEvent_)
+  {
+    const CCapsuleCollider* pCapsule = static_cast<const CCapsuleCollider*>(_pA);
+    return pCapsule->CheckCapsuleCollision(static_cast<const CCapsuleCollider*>(_pB), _oHitEvent_);
+  }
+  // ------------------------------------
+  bool CNarrowPhase::CheckOverlap(const collision::CCollider* _pA, const collision::CCollider* _pB, collision::THitEvent& _oHitEvent_)
+  {
+    bool bOverlap = false;
+    switch (static_cast<EBucket>(internal_narrow_phase::s_lstShapePairs[static_cast<uint32_t>(_pA->GetType())][static_cast<uint32_t>(_pB->GetType())]))
+    {
+      case EBucket::AABB_AABB:
+      {
+        bOverlap = internal_narrow_phase::OverlapBoxBox(internal_narrow_phase::GetBox(static_cast<const CBoxCollider*>(_pA)), internal_narrow_phase::GetBox(static_cast<const CBoxCollider*>(_pB)));
+        break;
+      }
+      case EBucket::SPHERE_SPHERE:
+      {
+        const CSphereCollider* pSphereA = static_cast<const CSphereCollider*>(_pA);
+        const CSphereCollider* pSphereB = static_cast<const CSphereCollider*>(_pB);
+        const float fRadiusSum = pSphereA->GetRadius() + pSphereB->GetRadius();
+        bOverlap = (pSphereA->GetCenter() - pSphereB->GetCenter()).GetSqrDist() <= fRadiusSum * fRadiusSum;
+        break;
+      }
+      case EBucket::BOX_SPHERE:
+      {
+        const CSphereCollider* pSphere = static_cast<const CSphereCollider*>(_pB);
+        bOverlap = internal_narrow_phase::SqDistPointBox(internal_narrow_phase::GetBox(static_cast<const CBoxCollider*>(_pA)), pSphere->GetCenter()) <= pSphere->GetRadius() * pSphere->GetRadius();
+        break;
+      }
+      case EBucket::BOX_CAPSULE:
+      {
+        const CCapsuleCollider* pCapsule = static_cast<const CCapsuleCollider*>(_pB);
+        bOverlap = internal_narrow_phase::OverlapBoxSegment(internal_narrow_phase::GetBox(static_cast<const CBoxCollider*>(_pA)), pCapsule->GetStartSegmentPoint(), pCapsule->GetEndSegmentPoint(), pCapsule->GetRadius());
+        break;
+      }
+      case EBucket::SPHERE_CAPSULE:
+      {
+        const CSphereCollider* pSphere = static_cast<const CSphereCollider*>(_pA);
+        const CCapsuleCollider* pCapsule = static_cast<const CCapsuleCollider*>(_pB);
+        const float fRadiusSum = pSphere->GetRadius() + pCapsule->GetRadius();
+        bOverlap = math::SqDistPointSegment(pCapsule->GetStartSegmentPoint(), pCapsule->GetEndSegmentPoint(), pSphere->GetCenter()) <= fRadiusSum * fRadiusSum;
+        break;
+      }
+      case EBucket::CAPSULE_CAPSULE:
+      {
+        const CCapsuleCollider* pCapsuleA = static_cast<const CCapsuleCollider*>(_pA);
+        const CCapsuleCollider* pCapsuleB = static_cast<const CCapsuleCollider*>(_pB);
+        const float fRadiusSum = pCapsuleA->GetRadius() + pCapsuleB->GetRadius();
+        float s = 0.0f, t = 0.0f;
+        math::CVector3 v3PointA, v3PointB;
+        bOverlap = math::ClosestPtSegmentSegment(pCapsuleA->GetStartSegmentPoint(), pCapsuleA->GetEndSegmentPoint(), pCapsuleB->GetStartSegmentPoint(), pCapsuleB->GetEndSegmentPoint(), s, t, v3PointA, v3PointB) <= fRadiusSum * fRadiusSum;
+        break;
+      }
+      default: break;
+    }
+
+    _oHitEvent_.Trigger = bOverlap;
+    return bOverlap;
+  }
+}
@@ -0,0 +1,97 @@
+#pragma once
+#include "Engine/Collisions/Collider.h"
+#include "Engine/Collisions/BroadPhase/BroadPhase.h"
+#include <vector>
+
+namespace collision { class CBoxCollider; }
+namespace collision { class CSphereCollider; }
+namespace collision { class CCapsuleCollider; }
+
+namespace collision
+{
+  struct TPairResult
+  {
+    collision::THitEvent HitEvent = collision::THitEvent(); // Seen from collider A
+    bool Hit = false;
+    bool Cached = false; // Neither collider moved, the previous result is still valid
+  };
+
+  // Pairs are bucketed by shape pair and every bucket runs its own kernel (no virtual calls, no type switch).
+  // Buckets are split in batches that run on the worker pool, every pair writes only its own result.
+  class CNarrowPhase
+  {
+  public:
+    typedef std::vector<collision::TPairResult> TResultList;
+    static constexpr uint32_t s_uBatchSize = 64u; // Multiple of the SIMD lane width
+
+  public:
+    CNarrowPhase() {}
+    ~CNarrowPhase() {}
+
+    // One result per pair, same order as the pair list (pairs without colliders moved at this frame are not tested)
+    void Execute(const collision::CBroadPhase::TPairList& _lstPairs, uint32_t _uFrameStamp, TResultList& _lstResults_);
+
+    // Single pair test (scene queries), same kernels as the buckets and the result is seen from A
+    static bool CheckPair(const collision::CCollider* _pA, const collision::CCollider* _pB, collision::THitEvent& _oHitEvent_);
+
+  private:
+    enum EBucket : uint32_t
+    {
+      AABB_AABB,
+      OBB_OBB,
+      SPHERE_SPHERE,
+      BOX_SPHERE,
+      BOX_CAPSULE,
+      SPHERE_CAPSULE,
+      CAPSULE_CAPSULE,
+      TRIGGER, // Any shape pair with a trigger, overlap only
+      COUNT
+    };
+
+    struct TBucketEntry
+    {
+      const collision::CCollider* ColliderA = nullptr; // Lowest shape type
+      const collision::CCollider* ColliderB = nullptr;
+      uint32_t PairIdx = 0;
+      bool Flip = false; // Pair order is the opposite of the bucket order
+    };
+
+    struct TJob
+    {
+      EBucket Bucket = EBucket::COUNT;
+      uint32_t Begin = 0;
+      uint32_t End = 0;
+    };
+
+    // SIMD lanes (structure of arrays)
+    static constexpr uint32_t s_uLaneWidth = 4u;
+    static constexpr uint32_t s_uAABBLaneCount = 12u;
+    static constexpr uint32_t s_uSphereLaneCount = 8u;
+
+  private:
+    void FillBuckets(const collision::CBroadPhase::TPairList& _lstPairs, uint32_t _uFrameStamp, TResultList& _lstResults_);
+    void FillJobs();
+    void ExecuteJob(const TJob& _rJob, TResultList& _lstResults_);
+
+    void ExecuteAABBAABB(uint32_t _uBegin, uint32_t _uEnd, TResultList& _lstResults_);
+    void ExecuteSphereSphere(uint32_t _uBegin, uint32_t _uEnd, TResultList& _lstResults_);
+    template<typename TKernel>
+    void ExecuteBucket(EBucket _eBucket, uint32_t _uBegin, uint32_t _uEnd, TKernel&& _oKernel, TResultList& _lstResults_);
+
+    // Kernels (results are seen from the lowest shape type)
+    static bool CheckOBBOBB(const collision::CCollider* _pA, const collision::CCollider* _pB, collision::THitEvent& _oHitEvent_);
+    static bool CheckBoxSphere(const collision::CCollider* _pA, const collision::CCollider* _pB, collision::THitEvent& _oHitEvent_);
+    static bool CheckBoxCapsule(const collision::CCollider* _pA, const collision::CCollider* _pB, collision::THitEvent& _oHitEvent_);
+    static bool CheckSphereCapsule(const collision::CCollider* _pA, const collision::CCollider* _pB, collision::THitEvent& _oHitEvent_);
+    static bool CheckCapsuleCapsule(const collision::CCollider* _pA, const collision::CCollider* _pB, collision::THitEvent& _oHitEvent_);
+    // Boolean overlap (triggers), no contact data
+    static bool CheckOverlap(const collision::CCollider* _pA, const collision::CCollider* _pB, collision::THitEvent& _oHitEvent_);
+
+  private:
+    std::vector<TBucketEntry> m_lstBuckets[EBucket::COUNT];
+    std::vector<TJob> m_lstJobs;
+
+    std::vector<float> m_lstAABBLanes[s_uAABBLaneCount];
+    std::vector<float> m_lstSphereLanes[s_uSphereLaneCount];
+  };
+}
@@ -60,6 +60,11 @@ namespace collision
   {
     // Set world center
     m_v3Center = GetPos();
+
+    // Set bounds
+    math::CVector3 v3Radius(m_fRadius, m_fRadius, m_fRadius);
+    m_oBoundingBox.SetMin(m_v3Center - v3Radius);
+    m_oBoundingBox.SetMax(m_v3Center + v3Radius);
   }
   // ------------------------------------
   bool CSphereCollider::CheckSphereCollision(const CSphereCollider* _pOther, THitEvent& _oHitEvent_) const
@@ -90,7 +95,7 @@ namespace collision
     // Get OBB data
     const math::CVector3& v3OBBCenter = _pOther->GetCenter();
     const math::CVector3 v3HalfSize = _pOther->GetHalfSize();
-    const std::vector<math::CVector3> v3Axis = _pOther->GetAxisDirectors();
+    const CBoxCollider::TAxisDirectors v3Axis = _pOther->GetAxisDirectors();
 
     // Calculate dir
     const math::CVector3& v3SphereCenter = GetCenter();
@@ -8,6 +8,9 @@ namespace collision
 {
   class CSphereCollider final : public CCollider
   {
+  public:
+    friend class CNarrowPhase;
+
   public:
     CSphereCollider(void* _pOwner) : CCollider(EColliderType::SPHERE_COLLIDER, _pOwner) {}
     ~CSphereCollider() {}
@@ -18,7 +21,7 @@ namespace collision
 
     inline void SetCenter(const math::CVector3& _v3Center) { m_v3Center = _v3Center; }
     inline const math::CVector3& GetCenter() const { return m_v3Center; }
-    inline void SetRadius(float _fRadius) { m_fRadius = _fRadius; }
+    inline void SetRadius(float _fRadius) { m_fRadius = _fRadius; RecalculateCollider(); }
     inline const float& GetRadius() const { return m_fRadius; }
 
 #ifdef _DEBUG
@@ -1,5 +1,6 @@
 #include "GlobalResources.h"
 #include "Engine/Render/Graphics/Mesh.h"
+#include "Libs/Memory/ThreadCacheAllocator.h"
 
 namespace global
 {
@@ -30,9 +31,10 @@ namespace global
   }
 }
 
+// Small blocks come from the thread caches of the size class allocator (no lock on the CRT heap)
 void* operator new(std::size_t size)
 {
-  void* ptr = malloc(size);
+  void* ptr = mem::CThreadCacheAllocator::Alloc(size);
   if (!ptr)
   {
     throw std::bad_alloc();
@@ -40,14 +42,21 @@ void* operator new(std::size_t size)
   global::mem::s_oMemoryTracker.RegisterMem(size);
   return ptr;
 }
-void operator delete(void* ptr, size_t size) noexcept
+void operator delete(void* ptr) noexcept
 {
-  global::mem::s_oMemoryTracker.DeregisterMem(size);
-  free(ptr);
+  if (ptr)
+  {
+    global::mem::s_oMemoryTracker.DeregisterMem(mem::CThreadCacheAllocator::GetSize(ptr));
+    mem::CThreadCacheAllocator::Free(ptr);
+  }
+}
+void operator delete(void* ptr, size_t) noexcept
+{
+  operator delete(ptr);
 }
 void* operator new[](std::size_t size)
 {
-  void* ptr = malloc(size);
+  void* ptr = mem::CThreadCacheAllocator::Alloc(size);
   if (!ptr)
   {
     throw std::bad_alloc();
@@ -55,8 +64,11 @@ void* operator new[](std::size_t size)
   global::mem::s_oMemoryTracker.RegisterMem(size);
   return ptr;
 }
-void operator delete[](void* ptr, size_t size) noexcept
+void operator delete[](void* ptr) noexcept
+{
+  operator delete(ptr);
+}
+void operator delete[](void* ptr, size_t) noexcept
 {
-  global::mem::s_oMemoryTracker.DeregisterMem(size);
-  free(ptr);
+  operator delete(ptr);
 }
@@ -7,18 +7,19 @@ namespace global
   {
     void CMemoryTracker::RegisterMem(size_t _tSize)
     {
-      m_tAllocatedSize += _tSize;
-      m_tMemoryPeak += _tSize;
+      m_tAllocatedSize.fetch_add(_tSize, std::memory_order_relaxed);
+      m_tMemoryPeak.fetch_add(_tSize, std::memory_order_relaxed);
+      m_tAllocCount.fetch_add(1, std::memory_order_relaxed);
     }
     // ------------------------------------
     void CMemoryTracker::DeregisterMem(size_t _tSize)
     {
-      m_tAllocatedSize -= _tSize;
+      m_tAllocatedSize.fetch_sub(_tSize, std::memory_order_relaxed);
     }
     // ------------------------------------
     void CMemoryTracker::PrintStats() const
     {
-      printf("Current size bytes: %zu - Memory peak: %zu\n", m_tAllocatedSize, m_tMemoryPeak);
+      printf("Current size bytes: %zu - Memory peak: %zu\n", GetAllocatedSize(), GetMemoryPeak());
     }
   }
 }
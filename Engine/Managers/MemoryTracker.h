@@ -1,23 +1,29 @@
 #pragma once
+#include <atomic>
+#include <cstddef>
 
 namespace global
 {
   namespace mem
   {
+    // Updated by every thread (global operator new)
     class CMemoryTracker
     {
     public:
       void RegisterMem(size_t _tSize);
       void DeregisterMem(size_t _tSize);
 
-      size_t GetAllocatedSize() const { return m_tAllocatedSize; }
-      size_t GetMemoryPeak() const { return m_tAllocatedSize; }
+      size_t GetAllocatedSize() const { return m_tAllocatedSize.load(std::memory_order_relaxed); }
+      size_t GetMemoryPeak() const { return m_tAllocatedSize.load(std::memory_order_relaxed); }
+      // Number of allocations since startup (allocation-free paths are checked against it)
+      size_t GetAllocCount() const { return m_tAllocCount.load(std::memory_order_relaxed); }
 
       void PrintStats() const;
 
     private:
-      size_t m_tAllocatedSize = 0;
-      size_t m_tMemoryPeak = 0;
+      std::atomic<size_t> m_tAllocatedSize{ 0 };
+      std::atomic<size_t> m_tMemoryPeak{ 0 };
+      std::atomic<size_t> m_tAllocCount{ 0 };
     };
   }
 }
@@ -0,0 +1,404 @@
+#include "ContactSolver.h"
+#include "Rigidbody.h"
+#include "Libs/Math/Math.h"
+#include "Libs/Math/Matrix4x4.h"
+#include "Libs/Utils/WorkerPool.h"
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
+namespace physics
+{
+  namespace internal_contact_solver
+  {
+    static constexpr float s_fBaumgarte = 0.2f; // Fraction of the penetration solved per step
+    static constexpr float s_fPenetrationSlop = 0.01f;
+    static constexpr float s_fRestitutionThreshold = 1.0f; // Slower impacts do not bounce
+    static constexpr float s_fPersistentThreshold = 0.05f; // Max drift of a persistent point
+    static constexpr float s_fDefaultFriction = 0.5f; // Colliders without rigidbody
+
+    inline math::CVector3 ToLocal(const collision::CCollider* _pCollider, const math::CVector3& _v3World)
+    {
+      math::CMatrix4x4 mInvRot = math::CMatrix4x4::Transpose(math::CMatrix4x4::CreateRotation(_pCollider->GetRot()));
+      return mInvRot * (_v3World - _pCollider->GetPos());
+    }
+
+    inline math::CVector3 ToWorld(const collision::CCollider* _pCollider, const math::CVector3& _v3Local)
+    {
+      return (math::CMatrix4x4::CreateRotation(_pCollider->GetRot()) * _v3Local) + _pCollider->GetPos();
+    }
+
+    inline void ComputeTangents(const math::CVector3& _v3Normal, math::CVector3& _v3TangentA_, math::CVector3& _v3TangentB_)
+    {
+      // Any axis not parallel to the normal
+      const math::CVector3 v3Axis = std::fabs(_v3Normal.x) < 0.57735f ? math::CVector3(1.0f, 0.0f, 0.0f) : math::CVector3(0.0f, 1.0f, 0.0f);
+      _v3TangentA_ = math::CVector3::Normalize(_v3Normal.Cross(v3Axis));
+      _v3TangentB_ = _v3Normal.Cross(_v3TangentA_);
+    }
+
+    inline float ComputeEffectiveMass(const math::CVector3& _v3RelativeA, const math::CVector3& _v3RelativeB, const math::CVector3& _v3Dir, float _fInvMassA, const TInertiaTensor& _rInvInertiaA, float _fInvMassB, const TInertiaTensor& _rInvInertiaB)
+    {
+      const math::CVector3 v3CrossA = _v3RelativeA.Cross(_v3Dir);
+      const math::CVector3 v3CrossB = _v3RelativeB.Cross(_v3Dir);
+      float fK = _fInvMassA + _fInvMassB + v3CrossA.Dot(_rInvInertiaA * v3CrossA) + v3CrossB.Dot(_rInvInertiaB * v3CrossB);
+      return fK > math::s_fEpsilon7 ? 1.0f / fK : 0.0f;
+    }
+
+    // Lever arms start at the center of mass
+    inline math::CVector3 GetCenterOfMass(const collision::CCollider* _pCollider)
+    {
+      const CRigidbody* pRigidbody = _pCollider->GetRigidbody();
+      return pRigidbody ? _pCollider->GetPos() + pRigidbody->GetCenterOfMass() : _pCollider->GetPos();
+    }
+
+    inline math::CVector3 ComputeRelativeVelocity(const math::CVector3& _v3RelativeA, const math::CVector3& _v3RelativeB, const math::CVector3& _v3VelA, const math::CVector3& _v3AngVelA, const math::CVector3& _v3VelB, const math::CVector3& _v3AngVelB)
+    {
+      return (_v3VelA + _v3AngVelA.Cross(_v3RelativeA)) - (_v3VelB + _v3AngVelB.Cross(_v3RelativeB));
+    }
+  }
+  // ------------------------------------
+  void CContactSolver::UpdateManifolds(const collision::CCollisionManager::TContactList& _lstContacts)
+  {
+    m_lstNextManifolds.clear();
+
+    // Both lists are sorted by key, manifolds without a contact are dropped
+    size_t tPrevIdx = 0;
+    for (const collision::CCollisionManager::TContact& rContact : _lstContacts)
+    {
+      // Nothing to solve between immovable or sleeping colliders, triggers have no response
+      if ((!IsAwake(rContact.ColliderA) && !IsAwake(rContact.ColliderB)) || rContact.HitEvent.Trigger)
+      {
+        continue;
+      }
+
+      while (tPrevIdx < m_lstManifolds.size() && m_lstManifolds[tPrevIdx].Key < rContact.Key)
+      {
+        tPrevIdx++;
+      }
+
+      TManifold& rManifold = m_lstNextManifolds.emplace_back();
+      bool bPersistent = tPrevIdx < m_lstManifolds.size() && m_lstManifolds[tPrevIdx].Key == rContact.Key;
+      if (bPersistent)
+      {
+        rManifold = m_lstManifolds[tPrevIdx++];
+      }
+      else
+      {
+        rManifold.Key = rContact.Key;
+        rManifold.PointCount = 0;
+      }
+
+      rManifold.ColliderA = rContact.ColliderA;
+      rManifold.ColliderB = rContact.ColliderB;
+      if (bPersistent)
+      {
+        RefreshPoints(rManifold);
+      }
+      rManifold.Normal = math::CVector3::Normalize(rContact.HitEvent.Normal);
+      AddPoint(rManifold, rContact.HitEvent);
+    }
+
+    m_lstManifolds.swap(m_lstNextManifolds);
+  }
+  // ------------------------------------
+  void CContactSolver::Solve(float _fDeltaTime, const CIslands& _rIslands, CRigidbodyLanes& _rLanes_)
+  {
+    if (_fDeltaTime <= 0.0f)
+    {
+      return;
+    }
+
+    // Islands do not share bodies, each one is solved by a single worker
+    GatherIslands(_rIslands, _rLanes_);
+    utils::CWorkerPool::GetInstance()->ParallelFor(static_cast<uint32_t>(m_lstIslandSolves.size()), 1u, [&](uint32_t _uBegin, uint32_t _uEnd, uint32_t /*_uWorkerIdx*/)
+    {
+      for (uint32_t uIndex = _uBegin; uIndex < _uEnd; ++uIndex)
+      {
+        SolveIsland(m_lstIslandSolves[uIndex], _fDeltaTime, _rLanes_);
+      }
+    });
+  }
+  // ------------------------------------
+  void CContactSolver::GatherIslands(const CIslands& _rIslands, const CRigidbodyLanes& _rLanes)
+  {
+    // Island of each manifold (both dynamic sides are always in the same island)
+    const uint32_t uIslandCount = static_cast<uint32_t>(_rIslands.GetIslands().size());
+    m_lstIslandSolves.clear();
+    m_lstIslandSolves.resize(uIslandCount);
+    for (TManifold& rManifold : m_lstManifolds)
+    {
+      const collision::CCollider* pCollider = IsDynamic(rManifold.ColliderA) ? rManifold.ColliderA : rManifold.ColliderB;
+      rManifold.Island = _rIslands.GetIslandIdx(pCollider->GetRigidbody()->GetLaneIdx());
+      m_lstIslandSolves[rManifold.Island].ManifoldCount++;
+    }
+
+    // Counting sort, key order inside each island
+    uint32_t uOffset = 0;
+    for (TIslandSolve& rIslandSolve : m_lstIslandSolves)
+    {
+      rIslandSolve.FirstManifold = uOffset;
+      uOffset += rIslandSolve.ManifoldCount;
+      rIslandSolve.ManifoldCount = 0;
+    }
+    m_lstManifoldOrder.resize(m_lstManifolds.size());
+    for (uint32_t uIndex = 0; uIndex < static_cast<uint32_t>(m_lstManifolds.size()); ++uIndex)
+    {
+      TIslandSolve& rIslandSolve = m_lstIslandSolves[m_lstManifolds[uIndex].Island];
+      m_lstManifoldOrder[rIslandSolve.FirstManifold + rIslandSolve.ManifoldCount++] = uIndex;
+    }
+
+    // Islands without contacts have nothing to solve
+    m_lstIslandSolves.erase(std::remove_if(m_lstIslandSolves.begin(), m_lstIslandSolves.end(), [](const TIslandSolve& _rIslandSolve)
+    {
+      return _rIslandSolve.ManifoldCount == 0;
+    }), m_lstIslandSolves.end());
+
+    // Bodies in contact, every island starts with its own immovable body (no writes shared between workers)
+    m_lstSolverBodies.clear();
+    for (TIslandSolve& rIslandSolve : m_lstIslandSolves)
+    {
+      rIslandSolve.FirstBody = static_cast<uint32_t>(m_lstSolverBodies.size());
+      m_lstSolverBodies.emplace_back();
+      for (uint32_t uIndex = rIslandSolve.FirstManifold; uIndex < rIslandSolve.FirstManifold + rIslandSolve.ManifoldCount; ++uIndex)
+      {
+        TManifold& rManifold = m_lstManifolds[m_lstManifoldOrder[uIndex]];
+        rManifold.BodyA = GetSolverBody(rManifold.ColliderA, rIslandSolve.FirstBody, _rLanes);
+        rManifold.BodyB = GetSolverBody(rManifold.ColliderB, rIslandSolve.FirstBody, _rLanes);
+      }
+      rIslandSolve.BodyCount = static_cast<uint32_t>(m_lstSolverBodies.size()) - rIslandSolve.FirstBody;
+    }
+  }
+  // ------------------------------------
+  void CContactSolver::SolveIsland(const TIslandSolve& _rIslandSolve, float _fDeltaTime, CRigidbodyLanes& _rLanes_)
+  {
+    const uint32_t uFirstManifold = _rIslandSolve.FirstManifold;
+    const uint32_t uLastManifold = _rIslandSolve.FirstManifold + _rIslandSolve.ManifoldCount;
+
+    // Prepare + warm start with the impulses of the last step
+    for (uint32_t uIndex = uFirstManifold; uIndex < uLastManifold; ++uIndex)
+    {
+      TManifold& rManifold = m_lstManifolds[m_lstManifoldOrder[uIndex]];
+      TSolverBody& rBodyA = m_lstSolverBodies[rManifold.BodyA];
+      TSolverBody& rBodyB = m_lstSolverBodies[rManifold.BodyB];
+      PrepareManifold(rManifold, rBodyA, rBodyB, _fDeltaTime);
+      WarmStart(rManifold, rBodyA, rBodyB);
+    }
+
+    // Velocity iterations (key order, deterministic)
+    for (uint32_t uIteration = 0; uIteration < m_uVelocityIterations; ++uIteration)
+    {
+      for (uint32_t uIndex = uFirstManifold; uIndex < uLastManifold; ++uIndex)
+      {
+        TManifold& rManifold = m_lstManifolds[m_lstManifoldOrder[uIndex]];
+        SolveManifold(rManifold, m_lstSolverBodies[rManifold.BodyA], m_lstSolverBodies[rManifold.BodyB]);
+      }
+    }
+
+    // Scatter (the immovable body is skipped), lanes of other islands are never touched
+    for (uint32_t uIndex = _rIslandSolve.FirstBody + 1; uIndex < _rIslandSolve.FirstBody + _rIslandSolve.BodyCount; ++uIndex)
+    {
+      const TSolverBody& rBody = m_lstSolverBodies[uIndex];
+      _rLanes_.SetVector(CRigidbodyLanes::VELOCITY_X, rBody.LaneIdx, rBody.Velocity);
+      _rLanes_.SetVector(CRigidbodyLanes::ANGULAR_VELOCITY_X, rBody.LaneIdx, rBody.AngularVelocity);
+      m_lstBodyMap[rBody.LaneIdx] = 0;
+    }
+  }
+  // ------------------------------------
+  void CContactSolver::Clear()
+  {
+    m_lstManifolds.clear();
+    m_lstNextManifolds.clear();
+    m_lstSolverBodies.clear();
+    m_lstIslandSolves.clear();
+    m_lstManifoldOrder.clear();
+  }
+  // ------------------------------------
+  void CContactSolver::CopyState(const CContactSolver& _rOther)
+  {
+    static_assert(std::is_trivially_copyable_v<TManifold>, "Manifolds are copied as plain memory");
+    m_lstManifolds = _rOther.m_lstManifolds;
+  }
+  // ------------------------------------
+  bool CContactSolver::IsDynamic(const collision::CCollider* _pCollider)
+  {
+    const CRigidbody* pRigidbody = _pCollider->GetRigidbody();
+    return pRigidbody && pRigidbody->GetRigidbodyType() == ERigidbodyType::DYNAMIC && pRigidbody->GetMass() > 0.0f;
+  }
+  // ------------------------------------
+  bool CContactSolver::IsAwake(const collision::CCollider* _pCollider)
+  {
+    return IsDynamic(_pCollider) && !_pCollider->GetRigidbody()->IsSleeping();
+  }
+  // ------------------------------------
+  uint32_t CContactSolver::GetSolverBody(const collision::CCollider* _pCollider, uint32_t _uImmovableBody, const CRigidbodyLanes& _rLanes)
+  {
+    // No rigidbody or kinematic: immovable
+    if (!IsDynamic(_pCollider))
+    {
+      return _uImmovableBody;
+    }
+
+    uint32_t uLaneIdx = _pCollider->GetRigidbody()->GetLaneIdx();
+    if (m_lstBodyMap[uLaneIdx] == 0)
+    {
+      TSolverBody& rBody = m_lstSolverBodies.emplace_back();
+      rBody.Velocity = _rLanes.GetVector(CRigidbodyLanes::VELOCITY_X, uLaneIdx);
+      rBody.AngularVelocity = _rLanes.GetVector(CRigidbodyLanes::ANGULAR_VELOCITY_X, uLaneIdx);
+      rBody.InvMass = _rLanes.Get(CRigidbodyLanes::INV_MASS, uLaneIdx);
+      rBody.InvInertia = _rLanes.GetInvInertia(uLaneIdx);
+      rBody.LaneIdx = uLaneIdx;
+      m_lstBodyMap[uLaneIdx] = static_cast<uint32_t>(m_lstSolverBodies.size() - 1);
+    }
+    return m_lstBodyMap[uLaneIdx];
+  }
+  // ------------------------------------
+  void CContactSolver::RefreshPoints(TManifold& _rManifold_) const
+  {
+    // Drop the points that drifted apart since they were found
+    uint32_t uCount = 0;
+    for (uint32_t uIndex = 0; uIndex < _rManifold_.PointCount; ++uIndex)
+    {
+      TManifoldPoint& rPoint = _rManifold_.Points[uIndex];
+      const math::CVector3 v3PointA = internal_contact_solver::ToWorld(_rManifold_.ColliderA, rPoint.LocalA);
+      const math::CVector3 v3PointB = internal_contact_solver::ToWorld(_rManifold_.ColliderB, rPoint.LocalB);
+      const math::CVector3 v3Offset = v3PointA - v3PointB;
+
+      const float fNormalOffset = v3Offset.Dot(_rManifold_.Normal);
+      const math::CVector3 v3TangentOffset = v3Offset - (_rManifold_.Normal * fNormalOffset);
+      rPoint.Depth = rPoint.InitialDepth - fNormalOffset;
+
+      bool bValid = rPoint.Depth > -internal_contact_solver::s_fPersistentThreshold &&
+        v3TangentOffset.Dot(v3TangentOffset) < (internal_contact_solver::s_fPersistentThreshold * internal_contact_solver::s_fPersistentThreshold);
+      if (bValid)
+      {
+        _rManifold_.Points[uCount++] = rPoint;
+      }
+    }
+    _rManifold_.PointCount = uCount;
+  }
+  // ------------------------------------
+  void CContactSolver::AddPoint(TManifold& _rManifold_, const collision::THitEvent& _oHitEvent) const
+  {
+    TManifoldPoint oNewPoint;
+    oNewPoint.LocalA = internal_contact_solver::ToLocal(_rManifold_.ColliderA, _oHitEvent.ImpactPoint);
+    oNewPoint.LocalB = internal_contact_solver::ToLocal(_rManifold_.ColliderB, _oHitEvent.ImpactPoint);
+    oNewPoint.InitialDepth = _oHitEvent.Depth;
+    oNewPoint.Depth = _oHitEvent.Depth;
+
+    // Same point as a persistent one: new anchors, same impulses
+    const float fSqrThreshold = internal_contact_solver::s_fPersistentThreshold * internal_contact_solver::s_fPersistentThreshold;
+    uint32_t uShallowestIdx = 0;
+    for (uint32_t uIndex = 0; uIndex < _rManifold_.PointCount; ++uIndex)
+    {
+      TManifoldPoint& rPoint = _rManifold_.Points[uIndex];
+      const math::CVector3 v3Offset = internal_contact_solver::ToWorld(_rManifold_.ColliderA, rPoint.LocalA) - _oHitEvent.ImpactPoint;
+      if (v3Offset.Dot(v3Offset) < fSqrThreshold)
+      {
+        oNewPoint.NormalImpulse = rPoint.NormalImpulse;
+        oNewPoint.TangentImpulses[0] = rPoint.TangentImpulses[0];
+        oNewPoint.TangentImpulses[1] = rPoint.TangentImpulses[1];
+        rPoint = oNewPoint;
+        return;
+      }
+      if (rPoint.Depth < _rManifold_.Points[uShallowestIdx].Depth)
+      {
+        uShallowestIdx = uIndex;
+      }
+    }
+
+    // Full manifold, the shallowest point is replaced
+    uint32_t uTargetIdx = _rManifold_.PointCount < s_uMaxManifoldPoints ? _rManifold_.PointCount++ : uShallowestIdx;
+    _rManifold_.Points[uTargetIdx] = oNewPoint;
+  }
+  // ------------------------------------
+  void CContactSolver::PrepareManifold(TManifold& _rManifold_, const TSolverBody& _rBodyA, const TSolverBody& _rBodyB, float _fDeltaTime) const
+  {
+    const CRigidbody* pRigidbodyA = _rManifold_.ColliderA->GetRigidbody();
+    const CRigidbody* pRigidbodyB = _rManifold_.ColliderB->GetRigidbody();
+    float fFrictionA = pRigidbodyA ? pRigidbodyA->GetFriction() : internal_contact_solver::s_fDefaultFriction;
+    float fFrictionB = pRigidbodyB ? pRigidbodyB->GetFriction() : internal_contact_solver::s_fDefaultFriction;
+    _rManifold_.Friction = (fFrictionA + fFrictionB) * 0.5f;
+    _rManifold_.Restitution = math::Max(pRigidbodyA ? pRigidbodyA->GetRestitution() : 0.0f, pRigidbodyB ? pRigidbodyB->GetRestitution() : 0.0f);
+
+    internal_contact_solver::ComputeTangents(_rManifold_.Normal, _rManifold_.Tangents[0], _rManifold_.Tangents[1]);
+
+    const math::CVector3 v3CenterA = internal_contact_solver::GetCenterOfMass(_rManifold_.ColliderA);
+    const math::CVector3 v3CenterB = internal_contact_solver::GetCenterOfMass(_rManifold_.ColliderB);
+    for (uint32_t uIndex = 0; uIndex < _rManifold_.PointCount; ++uIndex)
+    {
+      TManifoldPoint& rPoint = _rManifold_.Points[uIndex];
+      const math::CVector3 v3PointA = internal_contact_solver::ToWorld(_rManifold_.ColliderA, rPoint.LocalA);
+      const math::CVector3 v3PointB = internal_contact_solver::ToWorld(_rManifold_.ColliderB, rPoint.LocalB);
+      const math::CVector3 v3Point = (v3PointA + v3PointB) * 0.5f;
+      rPoint.RelativeA = v3Point - v3CenterA;
+      rPoint.RelativeB = v3Point - v3CenterB;
+
+      rPoint.NormalMass = internal_contact_solver::ComputeEffectiveMass(rPoint.RelativeA, rPoint.RelativeB, _rManifold_.Normal, _rBodyA.InvMass, _rBodyA.InvInertia, _rBodyB.InvMass, _rBodyB.InvInertia);
+      for (uint32_t uTangent = 0; uTangent < 2; ++uTangent)
+      {
+        rPoint.TangentMasses[uTangent] = internal_contact_solver::ComputeEffectiveMass(rPoint.RelativeA, rPoint.RelativeB, _rManifold_.Tangents[uTangent], _rBodyA.InvMass, _rBodyA.InvInertia, _rBodyB.InvMass, _rBodyB.InvInertia);
+      }
+
+      // Position error (Baumgarte) or bounce, the biggest one
+      const math::CVector3 v3RelVelocity = internal_contact_solver::ComputeRelativeVelocity(rPoint.RelativeA, rPoint.RelativeB, _rBodyA.Velocity, _rBodyA.AngularVelocity, _rBodyB.Velocity, _rBodyB.AngularVelocity);
+      const float fNormalVelocity = v3RelVelocity.Dot(_rManifold_.Normal);
+      float fPositionBias = (internal_contact_solver::s_fBaumgarte / _fDeltaTime) * math::Max(rPoint.Depth - internal_contact_solver::s_fPenetrationSlop, 0.0f);
+      float fBounceBias = fNormalVelocity < -internal_contact_solver::s_fRestitutionThreshold ? -_rManifold_.Restitution * fNormalVelocity : 0.0f;
+      rPoint.Bias = math::Max(fPositionBias, fBounceBias);
+    }
+  }
+  // ------------------------------------
+  void CContactSolver::WarmStart(const TManifold& _rManifold, TSolverBody& _rBodyA_, TSolverBody& _rBodyB_) const
+  {
+    for (uint32_t uIndex = 0; uIndex < _rManifold.PointCount; ++uIndex)
+    {
+      const TManifoldPoint& rPoint = _rManifold.Points[uIndex];
+      const math::CVector3 v3Impulse = (_rManifold.Normal * rPoint.NormalImpulse) + (_rManifold.Tangents[0] * rPoint.TangentImpulses[0]) + (_rManifold.Tangents[1] * rPoint.TangentImpulses[1]);
+
+      _rBodyA_.Velocity += v3Impulse * _rBodyA_.InvMass;
+      _rBodyA_.AngularVelocity += _rBodyA_.InvInertia * rPoint.RelativeA.Cross(v3Impulse);
+      _rBodyB_.Velocity -= v3Impulse * _rBodyB_.InvMass;
+      _rBodyB_.AngularVelocity -= _rBodyB_.InvInertia * rPoint.RelativeB.Cross(v3Impulse);
+    }
+  }
+  // ------------------------------------
+  void CContactSolver::SolveManifold(TManifold& _rManifold_, TSolverBody& _rBodyA_, TSolverBody& _rBodyB_) const
+  {
+    for (uint32_t uIndex = 0; uIndex < _rManifold_.PointCount; ++uIndex)
+    {
+      TManifoldPoint& rPoint = _rManifold_.Points[uIndex];
+
+      // Friction (bounded by the current normal impulse)
+      const float fMaxFriction = _rManifold_.Friction * rPoint.NormalImpulse;
+      for (uint32_t uTangent = 0; uTangent < 2; ++uTangent)
+      {
+        const math::CVector3& v3Tangent = _rManifold_.Tangents[uTangent];
+        const math::CVector3 v3RelVelocity = internal_contact_solver::ComputeRelativeVelocity(rPoint.RelativeA, rPoint.RelativeB, _rBodyA_.Velocity, _rBodyA_.AngularVelocity, _rBodyB_.Velocity, _rBodyB_.AngularVelocity);
+
+        float fLambda = -rPoint.TangentMasses[uTangent] * v3RelVelocity.Dot(v3Tangent);
+        float fOldImpulse = rPoint.TangentImpulses[uTangent];
+        rPoint.TangentImpulses[uTangent] = math::Clamp(fOldImpulse + fLambda, -fMaxFriction, fMaxFriction);
+        fLambda = rPoint.TangentImpulses[uTangent] - fOldImpulse;
+
+        const math::CVector3 v3Impulse = v3Tangent * fLambda;
+        _rBodyA_.Velocity += v3Impulse * _rBodyA_.InvMass;
+        _rBodyA_.AngularVelocity += _rBodyA_.InvInertia * rPoint.RelativeA.Cross(v3Impulse);
+        _rBodyB_.Velocity -= v3Impulse * _rBodyB_.InvMass;
+        _rBodyB_.AngularVelocity -= _rBodyB_.InvInertia * rPoint.RelativeB.Cross(v3Impulse);
+      }
+
+      // Normal (accumulated impulse never pulls)
+      const math::CVector3 v3RelVelocity = internal_contact_solver::ComputeRelativeVelocity(rPoint.RelativeA, rPoint.RelativeB, _rBodyA_.Velocity, _rBodyA_.AngularVelocity, _rBodyB_.Velocity, _rBodyB_.AngularVelocity);
+      float fLambda = rPoint.NormalMass * (rPoint.Bias - v3RelVelocity.Dot(_rManifold_.Normal));
+      float fOldImpulse = rPoint.NormalImpulse;
+      rPoint.NormalImpulse = math::Max(fOldImpulse + fLambda, 0.0f);
+      fLambda = rPoint.NormalImpulse - fOldImpulse;
+
+      const math::CVector3 v3Impulse = _rManifold_.Normal * fLambda;
+      _rBodyA_.Velocity += v3Impulse * _rBodyA_.InvMass;
+      _rBodyA_.AngularVelocity += _rBodyA_.InvInertia * rPoint.RelativeA.Cross(v3Impulse);
+      _rBodyB_.Velocity -= v3Impulse * _rBodyB_.InvMass;
+      _rBodyB_.AngularVelocity -= _rBodyB_.InvInertia * rPoint.RelativeB.Cross(v3Impulse);
+    }
+  }
+}
@@ -0,0 +1,110 @@
+#pragma once
+#include "Engine/Collisions/CollisionManager.h"
+#include "Libs/Math/Vector3.h"
+#include "RigidbodyLanes.h"
+#include "Islands.h"
+#include <vector>
+
+namespace physics
+{
+  // Sequential impulses over persistent contact manifolds, impulses of the last step are used as a warm start
+  class CContactSolver
+  {
+  public:
+    static constexpr uint32_t s_uMaxManifoldPoints = 4u;
+    static constexpr uint32_t s_uDefaultVelocityIterations = 8u;
+
+  public:
+    CContactSolver() {}
+    ~CContactSolver() {}
+
+    // Merge the contacts of the last collision update (sorted by key) with the current manifolds
+    void UpdateManifolds(const collision::CCollisionManager::TContactList& _lstContacts);
+    // Velocity constraints only, velocities are read from and written back to the lanes.
+    // Islands are solved in parallel, the result does not depend on the worker count
+    void Solve(float _fDeltaTime, const CIslands& _rIslands, CRigidbodyLanes& _rLanes_);
+    void Clear();
+    // Persistent state only (manifolds), the solver scratch is rebuilt every step
+    void CopyState(const CContactSolver& _rOther);
+
+    inline void SetVelocityIterations(uint32_t _uIterations) { m_uVelocityIterations = _uIterations; }
+    inline const uint32_t& GetVelocityIterations() const { return m_uVelocityIterations; }
+    inline size_t GetManifoldCount() const { return m_lstManifolds.size(); }
+
+  private:
+    struct TManifoldPoint
+    {
+      math::CVector3 LocalA = math::CVector3::Zero; // Anchor in the space of collider A
+      math::CVector3 LocalB = math::CVector3::Zero; // Anchor in the space of collider B
+      float InitialDepth = 0.0f;
+      float Depth = 0.0f;
+
+      // Accumulated impulses (warm start)
+      float NormalImpulse = 0.0f;
+      float TangentImpulses[2] = { 0.0f, 0.0f };
+
+      // Solver data
+      math::CVector3 RelativeA = math::CVector3::Zero;
+      math::CVector3 RelativeB = math::CVector3::Zero;
+      float NormalMass = 0.0f;
+      float TangentMasses[2] = { 0.0f, 0.0f };
+      float Bias = 0.0f;
+    };
+
+    struct TSolverBody
+    {
+      math::CVector3 Velocity = math::CVector3::Zero;
+      math::CVector3 AngularVelocity = math::CVector3::Zero;
+      float InvMass = 0.0f;
+      TInertiaTensor InvInertia = TInertiaTensor(); // World space
+      uint32_t LaneIdx = 0;
+    };
+
+    struct TManifold
+    {
+      uint64_t Key = 0; // Same key as the collision contact
+      collision::CCollider* ColliderA = nullptr;
+      collision::CCollider* ColliderB = nullptr;
+      uint32_t BodyA = 0; // Solver body (first body of the island = immovable)
+      uint32_t BodyB = 0;
+      uint32_t Island = 0;
+      math::CVector3 Normal = math::CVector3::Zero; // From B to A
+      math::CVector3 Tangents[2] = { math::CVector3::Zero, math::CVector3::Zero };
+      float Friction = 0.0f;
+      float Restitution = 0.0f;
+
+      TManifoldPoint Points[s_uMaxManifoldPoints];
+      uint32_t PointCount = 0;
+    };
+
+    // Manifolds and solver bodies of one island
+    struct TIslandSolve
+    {
+      uint32_t FirstManifold = 0; // Index in the manifold order
+      uint32_t ManifoldCount = 0;
+      uint32_t FirstBody = 0;
+      uint32_t BodyCount = 0;
+    };
+
+  private:
+    static bool IsDynamic(const collision::CCollider* _pCollider);
+    static bool IsAwake(const collision::CCollider* _pCollider);
+    uint32_t GetSolverBody(const collision::CCollider* _pCollider, uint32_t _uImmovableBody, const CRigidbodyLanes& _rLanes);
+    void GatherIslands(const CIslands& _rIslands, const CRigidbodyLanes& _rLanes);
+    void SolveIsland(const TIslandSolve& _rIslandSolve, float _fDeltaTime, CRigidbodyLanes& _rLanes_);
+    void RefreshPoints(TManifold& _rManifold_) const;
+    void AddPoint(TManifold& _rManifold_, const collision::THitEvent& _oHitEvent) const;
+    void PrepareManifold(TManifold& _rManifold_, const TSolverBody& _rBodyA, const TSolverBody& _rBodyB, float _fDeltaTime) const;
+    void WarmStart(const TManifold& _rManifold, TSolverBody& _rBodyA_, TSolverBody& _rBodyB_) const;
+    void SolveManifold(TManifold& _rManifold_, TSolverBody& _rBodyA_, TSolverBody& _rBodyB_) const;
+
+  private:
+    std::vector<TManifold> m_lstManifolds; // Sorted by key
+    std::vector<TManifold> m_lstNextManifolds;
+    std::vector<TSolverBody> m_lstSolverBodies; // One per dynamic body in contact + one immovable per island
+    std::vector<TIslandSolve> m_lstIslandSolves; // Island order
+    std::vector<uint32_t> m_lstManifoldOrder; // Manifolds grouped by island
+    uint32_t m_lstBodyMap[CRigidbodyLanes::s_uMaxBodies] = {}; // Lane -> solver body (0 = none, always an immovable body)
+    uint32_t m_uVelocityIterations = s_uDefaultVelocityIterations;
+  };
+}
@@ -0,0 +1,103 @@
+#include "Islands.h"
+#include "Rigidbody.h"
+
+namespace physics
+{
+  void CIslands::Build(const collision::CCollisionManager::TContactList& _lstContacts, const CRigidbodyLanes& _rLanes)
+  {
+    // Every body is its own island
+    const uint32_t uCount = _rLanes.GetCount();
+    for (uint32_t uLaneIdx = 0; uLaneIdx < uCount; ++uLaneIdx)
+    {
+      m_lstParents[uLaneIdx] = uLaneIdx;
+      m_lstIslandIdx[uLaneIdx] = s_uInvalidIsland;
+    }
+
+    // Static and kinematic colliders do not propagate (a floor does not join everything above it), neither do triggers
+    for (const collision::CCollisionManager::TContact& rContact : _lstContacts)
+    {
+      if (IsDynamic(rContact.ColliderA) && IsDynamic(rContact.ColliderB) && !rContact.HitEvent.Trigger)
+      {
+        Link(rContact.ColliderA->GetRigidbody()->GetLaneIdx(), rContact.ColliderB->GetRigidbody()->GetLaneIdx());
+      }
+    }
+
+    // Island per root
+    m_lstIslands.clear();
+    for (uint32_t uLaneIdx = 0; uLaneIdx < uCount; ++uLaneIdx)
+    {
+      const CRigidbody* pRigidbody = _rLanes.GetRigidbody(uLaneIdx);
+      if (pRigidbody->GetRigidbodyType() != ERigidbodyType::DYNAMIC)
+      {
+        continue;
+      }
+
+      uint32_t uRoot = FindRoot(uLaneIdx);
+      if (m_lstIslandIdx[uRoot] == s_uInvalidIsland)
+      {
+        m_lstIslandIdx[uRoot] = static_cast<uint32_t>(m_lstIslands.size());
+        m_lstIslands.emplace_back();
+      }
+      m_lstIslandIdx[uLaneIdx] = m_lstIslandIdx[uRoot];
+      m_lstIslands[m_lstIslandIdx[uLaneIdx]].BodyCount++;
+    }
+
+    // Offsets + counting sort
+    uint32_t uOffset = 0;
+    for (TIsland& rIsland : m_lstIslands)
+    {
+      rIsland.FirstBody = uOffset;
+      uOffset += rIsland.BodyCount;
+      rIsland.BodyCount = 0;
+    }
+    for (uint32_t uLaneIdx = 0; uLaneIdx < uCount; ++uLaneIdx)
+    {
+      uint32_t uIslandIdx = m_lstIslandIdx[uLaneIdx];
+      if (uIslandIdx != s_uInvalidIsland)
+      {
+        TIsland& rIsland = m_lstIslands[uIslandIdx];
+        m_lstBodies[rIsland.FirstBody + rIsland.BodyCount++] = uLaneIdx;
+      }
+    }
+  }
+  // ------------------------------------
+  void CIslands::Clear()
+  {
+    m_lstIslands.clear();
+  }
+  // ------------------------------------
+  bool CIslands::IsDynamic(const collision::CCollider* _pCollider)
+  {
+    const CRigidbody* pRigidbody = _pCollider->GetRigidbody();
+    return pRigidbody && pRigidbody->GetRigidbodyType() == ERigidbodyType::DYNAMIC;
+  }
+  // ------------------------------------
+  uint32_t CIslands::FindRoot(uint32_t _uLaneIdx)
+  {
+    // Path halving
+    while (m_lstParents[_uLaneIdx] != _uLaneIdx)
+    {
+      m_lstParents[_uLaneIdx] = m_lstParents[m_lstParents[_uLaneIdx]];
+      _uLaneIdx = m_lstParents[_uLaneIdx];
+    }
+    return _uLaneIdx;
+  }
+  // ------------------------------------
+  void CIslands::Link(uint32_t _uLaneA, uint32_t _uLaneB)
+  {
+    uint32_t uRootA = FindRoot(_uLaneA);
+    uint32_t uRootB = FindRoot(_uLaneB);
+    if (uRootA != uRootB)
+    {
+      // Lower lane as root (deterministic)
+      if (uRootA < uRootB)
+      {
+        m_lstParents[uRootB] = uRootA;
+      }
+      else
+      {
+        m_lstParents[uRootA] = uRootB;
+      }
+    }
+  }
+}
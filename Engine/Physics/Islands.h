@@ -0,0 +1,44 @@
+#pragma once
+#include "Engine/Collisions/CollisionManager.h"
+#include "RigidbodyLanes.h"
+#include <vector>
+
+namespace physics
+{
+  // Groups of dynamic bodies linked by contacts (union-find over lanes), rebuilt every step
+  class CIslands
+  {
+  public:
+    static constexpr uint32_t s_uInvalidIsland = static_cast<uint32_t>(-1);
+
+    struct TIsland
+    {
+      uint32_t FirstBody = 0; // Index in the body list
+      uint32_t BodyCount = 0;
+    };
+
+  public:
+    CIslands() {}
+    ~CIslands() {}
+
+    void Build(const collision::CCollisionManager::TContactList& _lstContacts, const CRigidbodyLanes& _rLanes);
+    void Clear();
+
+    inline const std::vector<TIsland>& GetIslands() const { return m_lstIslands; }
+    // Lanes grouped by island
+    inline const uint32_t& GetBody(uint32_t _uIndex) const { return m_lstBodies[_uIndex]; }
+    // Lane -> island (invalid for non dynamic bodies)
+    inline const uint32_t& GetIslandIdx(uint32_t _uLaneIdx) const { return m_lstIslandIdx[_uLaneIdx]; }
+
+  private:
+    static bool IsDynamic(const collision::CCollider* _pCollider);
+    uint32_t FindRoot(uint32_t _uLaneIdx);
+    void Link(uint32_t _uLaneA, uint32_t _uLaneB);
+
+  private:
+    std::vector<TIsland> m_lstIslands;
+    uint32_t m_lstParents[CRigidbodyLanes::s_uMaxBodies] = {};
+    uint32_t m_lstBodies[CRigidbodyLanes::s_uMaxBodies] = {};
+    uint32_t m_lstIslandIdx[CRigidbodyLanes::s_uMaxBodies] = {};
+  };
+}
@@ -0,0 +1,140 @@
+#include "MassProperties.h"
+#include "Engine/Collisions/BoxCollider.h"
+#include "Engine/Collisions/SphereCollider.h"
+#include "Engine/Collisions/CapsuleCollider.h"
+#include "Libs/Math/Math.h"
+#include <cmath>
+
+namespace physics
+{
+  namespace internal_mass_properties
+  {
+    TMassProperties ComputeBox(const collision::CBoxCollider& _oBox, float _fDensity)
+    {
+      const math::CVector3& v3Size = _oBox.GetSize();
+      const math::CVector3 v3Sqr = v3Size * v3Size;
+
+      TMassProperties oMassProperties = TMassProperties();
+      oMassProperties.Mass = _fDensity * v3Size.x * v3Size.y * v3Size.z;
+      const float fFactor = oMassProperties.Mass / 12.0f;
+      oMassProperties.Inertia = TInertiaTensor::CreateDiagonal(math::CVector3(v3Sqr.y + v3Sqr.z, v3Sqr.x + v3Sqr.z, v3Sqr.x + v3Sqr.y) * fFactor);
+      return oMassProperties;
+    }
+
+    TMassProperties ComputeSphere(const collision::CSphereCollider& _oSphere, float _fDensity)
+    {
+      const float fRadius = _oSphere.GetRadius();
+
+      TMassProperties oMassProperties = TMassProperties();
+      oMassProperties.Mass = _fDensity * (4.0f / 3.0f) * math::s_fPI * fRadius * fRadius * fRadius;
+      const float fInertia = 0.4f * oMassProperties.Mass * fRadius * fRadius;
+      oMassProperties.Inertia = TInertiaTensor::CreateDiagonal(math::CVector3(fInertia, fInertia, fInertia));
+      return oMassProperties;
+    }
+
+    TMassProperties ComputeCapsule(const collision::CCapsuleCollider& _oCapsule, float _fDensity)
+    {
+      // Cylinder + two hemispheres (one sphere), hemispheres are shifted along the axis
+      const float fRadius = _oCapsule.GetRadius();
+      const float fSqrRadius = fRadius * fRadius;
+      const float fHeight = math::Max(_oCapsule.GetHeight() - (fRadius * 2.0f), 0.0f);
+      const float fCylinderMass = _fDensity * math::s_fPI * fSqrRadius * fHeight;
+      const float fSphereMass = _fDensity * (4.0f / 3.0f) * math::s_fPI * fSqrRadius * fRadius;
+
+      const float fAxialInertia = (fCylinderMass * fSqrRadius * 0.5f) + (fSphereMass * fSqrRadius * 0.4f);
+      const float fCylinderInertia = fCylinderMass * ((fHeight * fHeight / 12.0f) + (fSqrRadius * 0.25f));
+      const float fSphereInertia = fSphereMass * ((fSqrRadius * 0.4f) + (fHeight * fHeight * 0.25f) + (fHeight * fRadius * 0.375f));
+      const float fRadialInertia = fCylinderInertia + fSphereInertia;
+
+      // I = radial * Id + (axial - radial) * (a * a^T)
+      const math::CVector3 v3Axis = math::CVector3::Normalize(_oCapsule.GetOrientedAxis());
+      const float fDelta = fAxialInertia - fRadialInertia;
+
+      TMassProperties oMassProperties = TMassProperties();
+      oMassProperties.Mass = fCylinderMass + fSphereMass;
+      oMassProperties.CenterOfMass = _oCapsule.GetLocalCenter();
+      oMassProperties.Inertia = TInertiaTensor::CreateDiagonal(math::CVector3(fRadialInertia, fRadialInertia, fRadialInertia));
+      oMassProperties.Inertia.XX += fDelta * v3Axis.x * v3Axis.x;
+      oMassProperties.Inertia.YY += fDelta * v3Axis.y * v3Axis.y;
+      oMassProperties.Inertia.ZZ += fDelta * v3Axis.z * v3Axis.z;
+      oMassProperties.Inertia.XY = fDelta * v3Axis.x * v3Axis.y;
+      oMassProperties.Inertia.XZ = fDelta * v3Axis.x * v3Axis.z;
+      oMassProperties.Inertia.YZ = fDelta * v3Axis.y * v3Axis.z;
+      return oMassProperties;
+    }
+  }
+  // ------------------------------------
+  TInertiaTensor TInertiaTensor::CreateDiagonal(const math::CVector3& _v3Diagonal)
+  {
+    TInertiaTensor oTensor = TInertiaTensor();
+    oTensor.XX = _v3Diagonal.x;
+    oTensor.YY = _v3Diagonal.y;
+    oTensor.ZZ = _v3Diagonal.z;
+    return oTensor;
+  }
+  // ------------------------------------
+  TInertiaTensor TInertiaTensor::operator*(float _fValue) const
+  {
+    TInertiaTensor oTensor = *this;
+    oTensor.XX *= _fValue; oTensor.YY *= _fValue; oTensor.ZZ *= _fValue;
+    oTensor.XY *= _fValue; oTensor.XZ *= _fValue; oTensor.YZ *= _fValue;
+    return oTensor;
+  }
+  // ------------------------------------
+  TInertiaTensor TInertiaTensor::Inverse() const
+  {
+    // Cofactors (the inverse of a symmetric matrix is symmetric)
+    const float fCofXX = (YY * ZZ) - (YZ * YZ);
+    const float fCofXY = (XZ * YZ) - (XY * ZZ);
+    const float fCofXZ = (XY * YZ) - (XZ * YY);
+    const float fDet = (XX * fCofXX) + (XY * fCofXY) + (XZ * fCofXZ);
+    if (std::fabs(fDet) <= math::s_fEpsilon7)
+    {
+      return TInertiaTensor();
+    }
+
+    const float fInvDet = 1.0f / fDet;
+    TInertiaTensor oTensor = TInertiaTensor();
+    oTensor.XX = fCofXX * fInvDet;
+    oTensor.XY = fCofXY * fInvDet;
+    oTensor.XZ = fCofXZ * fInvDet;
+    oTensor.YY = ((XX * ZZ) - (XZ * XZ)) * fInvDet;
+    oTensor.YZ = ((XY * XZ) - (XX * YZ)) * fInvDet;
+    oTensor.ZZ = ((XX * YY) - (XY * XY)) * fInvDet;
+    return oTensor;
+  }
+  // ------------------------------------
+  TInertiaTensor TInertiaTensor::Rotate(const math::CMatrix4x4& _mRot) const
+  {
+    // Columns of the rotation (column-major), R(i, k) = m[4k + i]
+    const math::CVector3 v3ColX(_mRot[0], _mRot[1], _mRot[2]);
+    const math::CVector3 v3ColY(_mRot[4], _mRot[5], _mRot[6]);
+    const math::CVector3 v3ColZ(_mRot[8], _mRot[9], _mRot[10]);
+
+    // M = R * I (I is symmetric, its columns are its rows)
+    const math::CVector3 v3MX = (v3ColX * XX) + (v3ColY * XY) + (v3ColZ * XZ);
+    const math::CVector3 v3MY = (v3ColX * XY) + (v3ColY * YY) + (v3ColZ * YZ);
+    const math::CVector3 v3MZ = (v3ColX * XZ) + (v3ColY * YZ) + (v3ColZ * ZZ);
+
+    // M * R^T
+    TInertiaTensor oTensor = TInertiaTensor();
+    oTensor.XX = (v3MX.x * v3ColX.x) + (v3MY.x * v3ColY.x) + (v3MZ.x * v3ColZ.x);
+    oTensor.YY = (v3MX.y * v3ColX.y) + (v3MY.y * v3ColY.y) + (v3MZ.y * v3ColZ.y);
+    oTensor.ZZ = (v3MX.z * v3ColX.z) + (v3MY.z * v3ColY.z) + (v3MZ.z * v3ColZ.z);
+    oTensor.XY = (v3MX.x * v3ColX.y) + (v3MY.x * v3ColY.y) + (v3MZ.x * v3ColZ.y);
+    oTensor.XZ = (v3MX.x * v3ColX.z) + (v3MY.x * v3ColY.z) + (v3MZ.x * v3ColZ.z);
+    oTensor.YZ = (v3MX.y * v3ColX.z) + (v3MY.y * v3ColY.z) + (v3MZ.y * v3ColZ.z);
+    return oTensor;
+  }
+  // ------------------------------------
+  TMassProperties ComputeMassProperties(const collision::CCollider& _oCollider, float _fDensity)
+  {
+    switch (_oCollider.GetType())
+    {
+      case collision::EColliderType::BOX_COLLIDER: return internal_mass_properties::ComputeBox(static_cast<const collision::CBoxCollider&>(_oCollider), _fDensity);
+      case collision::EColliderType::SPHERE_COLLIDER: return internal_mass_properties::ComputeSphere(static_cast<const collision::CSphereCollider&>(_oCollider), _fDensity);
+      case collision::EColliderType::CAPSULE_COLLIDER: return internal_mass_properties::ComputeCapsule(static_cast<const collision::CCapsuleCollider&>(_oCollider), _fDensity);
+      default: return TMassProperties();
+    }
+  }
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include "Libs/Math/Vector3.h"
+#include "Libs/Math/Matrix4x4.h"
+
+namespace collision { class CCollider; }
+
+namespace physics
+{
+  // Symmetric 3x3 matrix (inertia tensors)
+  struct TInertiaTensor
+  {
+    float XX = 0.0f, YY = 0.0f, ZZ = 0.0f;
+    float XY = 0.0f, XZ = 0.0f, YZ = 0.0f;
+
+    static TInertiaTensor CreateDiagonal(const math::CVector3& _v3Diagonal);
+
+    inline math::CVector3 operator*(const math::CVector3& _v3) const
+    {
+      return math::CVector3((XX * _v3.x) + (XY * _v3.y) + (XZ * _v3.z), (XY * _v3.x) + (YY * _v3.y) + (YZ * _v3.z), (XZ * _v3.x) + (YZ * _v3.y) + (ZZ * _v3.z));
+    }
+    TInertiaTensor operator*(float _fValue) const;
+
+    // Zero if singular (infinite inertia)
+    TInertiaTensor Inverse() const;
+    // R * I * R^T, only the rotation of the matrix is used
+    TInertiaTensor Rotate(const math::CMatrix4x4& _mRot) const;
+  };
+
+  struct TMassProperties
+  {
+    float Mass = 0.0f;
+    math::CVector3 CenterOfMass = math::CVector3::Zero; // Offset from the collider position
+    TInertiaTensor Inertia = TInertiaTensor(); // About the center of mass, collider space
+  };
+
+  static constexpr float s_fDefaultDensity = 1.0f; // Unit box = unit mass
+
+  // Solid box, sphere or capsule of uniform density
+  TMassProperties ComputeMassProperties(const collision::CCollider& _oCollider, float _fDensity = s_fDefaultDensity);
+}
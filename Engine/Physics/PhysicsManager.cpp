@@ -3,7 +3,10 @@
 #include "Rigidbody.h"
 #include "Game/Entity/Entity.h"
 #include "Libs/Time/TimeManager.h"
+#include "Libs/Math/Math.h"
+#include "Engine/Collisions/CollisionManager.h"
 #include <iostream>
+#include <type_traits>
 
 namespace physics
 {
@@ -12,13 +15,9 @@ namespace physics
     const float s_fGravityForce(9.8f);
     static math::CVector3 s_v3GravityForce(0.0f, -internal_physics_manager::s_fGravityForce, 0.0f);
 
-    // Fast exponential approximation: exp(-x) ≈ 1 / (1 + x) for small x
-    // More accurate for physics drag calculations
-    inline float FastExpApprox(float x)
+    inline bool IsExactZero(const math::CVector3& _v3)
     {
-      // Using Padé approximant for better accuracy: exp(-x) ≈ (12 - 6x) / (12 + 6x)
-      const float c = 6.0f * x;
-      return (12.0f - c) / (12.0f + c);
+      return _v3.x == 0.0f && _v3.y == 0.0f && _v3.z == 0.0f;
     }
   }
   // ------------------------------------
@@ -29,69 +28,234 @@ namespace physics
   // ------------------------------------
   void CPhysicsManager::Update(float _fDeltaTime)
   {
-    for (uint32_t uIndex = 0; uIndex < m_lstRigidbodys.GetSize(); ++uIndex)
+    // Forces -> velocities (gravity + drag)
+    collision::CCollisionManager* pCollisionManager = collision::CCollisionManager::GetInstance();
+    if (pCollisionManager)
     {
-      utils::CWeakPtr<physics::CRigidbody> pRigidbody = m_lstRigidbodys[uIndex];
-      bool bDynamic = pRigidbody->GetRigidbodyType() == physics::ERigidbodyType::DYNAMIC;
-      if (!bDynamic)
+      UpdateInertiaTensors();
+    }
+    m_oLanes.Integrate(_fDeltaTime, internal_physics_manager::s_v3GravityForce);
+
+    // Contacts of the last collision step
+    if (pCollisionManager)
+    {
+      const collision::CCollisionManager::TContactList& lstContacts = pCollisionManager->GetContacts();
+      m_oContactSolver.UpdateManifolds(lstContacts);
+      m_oIslands.Build(lstContacts, m_oLanes);
+      m_oContactSolver.Solve(_fDeltaTime, m_oIslands, m_oLanes);
+      SolveContinuousCollisions(_fDeltaTime);
+    }
+    else
+    {
+      m_oIslands.Build(collision::CCollisionManager::TContactList(), m_oLanes);
+    }
+    UpdateSleeping(_fDeltaTime);
+
+    // Velocities -> motions (bodies at rest are skipped)
+    m_lstMotions.clear();
+    for (uint32_t uLaneIdx = 0; uLaneIdx < m_oLanes.GetCount(); ++uLaneIdx)
+    {
+      if (m_oLanes.Get(CRigidbodyLanes::ACTIVE, uLaneIdx) == 0.0f)
       {
         continue;
       }
 
-      // Apply gravity force
-      pRigidbody->m_v3Acceleration += internal_physics_manager::s_v3GravityForce;
+      math::CVector3 v3Displacement = m_oLanes.GetVector(CRigidbodyLanes::VELOCITY_X, uLaneIdx) * _fDeltaTime;
+      math::CVector3 v3AngularDisplacement = m_oLanes.GetVector(CRigidbodyLanes::ANGULAR_VELOCITY_X, uLaneIdx) * _fDeltaTime;
+      if (internal_physics_manager::IsExactZero(v3Displacement) && internal_physics_manager::IsExactZero(v3AngularDisplacement))
+      {
+        continue;
+      }
 
-      // Add acceleration
-      if (!pRigidbody->m_v3Acceleration.Equal(math::CVector3::Zero))
+      // rad/s -> euler degrees
+      TMotion& rMotion = m_lstMotions.emplace_back();
+      rMotion.Owner = m_oLanes.GetRigidbody(uLaneIdx)->GetOwner();
+      rMotion.Displacement = v3Displacement;
+      rMotion.Rotation = math::CVector3(math::Rad2Degrees(v3AngularDisplacement.x), math::Rad2Degrees(v3AngularDisplacement.y), math::Rad2Degrees(v3AngularDisplacement.z));
+    }
+  }
+  // ------------------------------------
+  void CPhysicsManager::UpdateInertiaTensors()
+  {
+    // Bodies rotate with their collider, the tensors are used in world space
+    collision::CCollisionManager* pCollisionManager = collision::CCollisionManager::GetInstance();
+    for (size_t tIndex = 0; tIndex < pCollisionManager->GetColliderCount(); ++tIndex)
+    {
+      const collision::CCollider* pCollider = pCollisionManager->GetCollider(tIndex);
+      CRigidbody* pRigidbody = pCollider->GetRigidbody();
+      if (pRigidbody && m_oLanes.Get(CRigidbodyLanes::ACTIVE, pRigidbody->GetLaneIdx()) != 0.0f)
       {
-        pRigidbody->m_v3Velocity += pRigidbody->m_v3Acceleration * _fDeltaTime;
+        pRigidbody->RefreshInertiaLanes(math::CMatrix4x4::CreateRotation(pCollider->GetRot()));
       }
+    }
+  }
+  // ------------------------------------
+  void CPhysicsManager::UpdateSleeping(float _fDeltaTime)
+  {
+    const float fSqrLinearVelocity = s_fSleepLinearVelocity * s_fSleepLinearVelocity;
+    const float fSqrAngularVelocity = s_fSleepAngularVelocity * s_fSleepAngularVelocity;
 
-      // Decrease velocity
-      bool bInTheAir = pRigidbody->GetRigidbodyState() == physics::ERigidbodyState::IN_THE_AIR;
-      const float fExpCoefficient = bInTheAir ? 0.1f : 0.2f;
-      pRigidbody->m_v3Velocity *= internal_physics_manager::FastExpApprox(fExpCoefficient * _fDeltaTime);
+    for (const CIslands::TIsland& rIsland : m_oIslands.GetIslands())
+    {
+      // Sleeping bodies are ready, an island is as restless as its fastest body
+      float fMinSleepTime = s_fTimeToSleep;
+      for (uint32_t uIndex = rIsland.FirstBody; uIndex < rIsland.FirstBody + rIsland.BodyCount; ++uIndex)
+      {
+        uint32_t uLaneIdx = m_oIslands.GetBody(uIndex);
+        CRigidbody* pRigidbody = m_oLanes.GetRigidbody(uLaneIdx);
+        if (pRigidbody->IsSleeping())
+        {
+          continue;
+        }
 
-      // Notify displacement -> i extracted this equation from the internet
-      math::CVector3 v3Displacement = (pRigidbody->m_v3Velocity * _fDeltaTime) + (pRigidbody->m_v3Acceleration * _fDeltaTime * _fDeltaTime * 0.5f);
-      pRigidbody->m_OnVelocityChangedDelegate(v3Displacement);
+        bool bResting = m_oLanes.GetVector(CRigidbodyLanes::VELOCITY_X, uLaneIdx).GetSqrDist() < fSqrLinearVelocity &&
+          m_oLanes.GetVector(CRigidbodyLanes::ANGULAR_VELOCITY_X, uLaneIdx).GetSqrDist() < fSqrAngularVelocity;
+        pRigidbody->m_fSleepTime = bResting ? pRigidbody->m_fSleepTime + _fDeltaTime : 0.0f;
+        fMinSleepTime = math::Min(fMinSleepTime, pRigidbody->m_fSleepTime);
+      }
 
-      // Compute angular displacement
-      if (!pRigidbody->m_v3Torque.Equal(math::CVector3::Zero))
+      // The whole island sleeps or wakes up
+      bool bSleep = fMinSleepTime >= s_fTimeToSleep;
+      for (uint32_t uIndex = rIsland.FirstBody; uIndex < rIsland.FirstBody + rIsland.BodyCount; ++uIndex)
+      {
+        CRigidbody* pRigidbody = m_oLanes.GetRigidbody(m_oIslands.GetBody(uIndex));
+        if (bSleep && !pRigidbody->IsSleeping())
+        {
+          pRigidbody->Sleep();
+        }
+        else if (!bSleep && pRigidbody->IsSleeping())
+        {
+          pRigidbody->WakeUp();
+        }
+      }
+    }
+  }
+  // ------------------------------------
+  void CPhysicsManager::SolveContinuousCollisions(float _fDeltaTime)
+  {
+    const float fSqrContinuousVelocity = m_fContinuousVelocity * m_fContinuousVelocity;
+    bool bFastBodies = false;
+    for (uint32_t uLaneIdx = 0; uLaneIdx < m_oLanes.GetCount() && !bFastBodies; ++uLaneIdx)
+    {
+      bFastBodies = m_oLanes.Get(CRigidbodyLanes::ACTIVE, uLaneIdx) != 0.0f && m_oLanes.GetVector(CRigidbodyLanes::VELOCITY_X, uLaneIdx).GetSqrDist() > fSqrContinuousVelocity;
+    }
+    if (!bFastBodies || _fDeltaTime <= 0.0f)
+    {
+      return;
+    }
+
+    collision::CCollisionManager* pCollisionManager = collision::CCollisionManager::GetInstance();
+    for (size_t tIndex = 0; tIndex < pCollisionManager->GetColliderCount(); ++tIndex)
+    {
+      const collision::CCollider* pCollider = pCollisionManager->GetCollider(tIndex);
+      const CRigidbody* pRigidbody = pCollider->GetRigidbody();
+      if (!pRigidbody || pCollider->IsTrigger() || m_oLanes.Get(CRigidbodyLanes::ACTIVE, pRigidbody->GetLaneIdx()) == 0.0f)
       {
-        pRigidbody->m_v3AngularVelocity += (pRigidbody->m_v3Torque / pRigidbody->m_fInertia) * _fDeltaTime;
+        continue;
       }
 
-      // Decrease angular velocity
-      const float fAngularDrag = internal_physics_manager::FastExpApprox(fExpCoefficient * _fDeltaTime);
-      pRigidbody->m_v3AngularVelocity *= fAngularDrag;
+      const uint32_t uLaneIdx = pRigidbody->GetLaneIdx();
+      math::CVector3 v3Velocity = m_oLanes.GetVector(CRigidbodyLanes::VELOCITY_X, uLaneIdx);
+      if (v3Velocity.GetSqrDist() <= fSqrContinuousVelocity)
+      {
+        continue;
+      }
 
-      // Notify angular displacement
-      pRigidbody->m_OnRotationChangedDelegate(pRigidbody->m_v3AngularVelocity * _fDeltaTime);
+      collision::TQueryHit oHit = collision::TQueryHit();
+      const math::CVector3 v3Displacement = v3Velocity * _fDeltaTime;
+      if (!pCollisionManager->SweepCollider(*pCollider, v3Displacement, oHit))
+      {
+        continue;
+      }
 
-      // Reset acceleration + torque
-      pRigidbody->m_v3Acceleration = math::CVector3::Zero;
-      pRigidbody->m_v3Torque = math::CVector3::Zero;
+      // Speculative contact: the normal velocity can only close the gap to the time of impact
+      const math::CVector3 v3Normal = math::CVector3::Normalize(oHit.HitEvent.Normal);
+      const math::CVector3 v3Dir = math::CVector3::Normalize(v3Displacement);
+      const float fMinNormalVelocity = (oHit.HitEvent.Distance * v3Dir.Dot(v3Normal)) / _fDeltaTime;
+      const float fNormalVelocity = v3Velocity.Dot(v3Normal);
+      if (fNormalVelocity < fMinNormalVelocity)
+      {
+        v3Velocity += v3Normal * (fMinNormalVelocity - fNormalVelocity);
+        m_oLanes.SetVector(CRigidbodyLanes::VELOCITY_X, uLaneIdx, v3Velocity);
+      }
     }
   }
   // ------------------------------------
-  utils::CWeakPtr<CRigidbody> CPhysicsManager::CreateRigidbody(ERigidbodyType _eRigidbodyType)
+  utils::CWeakPtr<CRigidbody> CPhysicsManager::CreateRigidbody(ERigidbodyType _eRigidbodyType, void* _pOwner)
   {
     if (m_lstRigidbodys.GetSize() >= m_lstRigidbodys.GetMaxSize())
     {
       WARNING_LOG("You have reached maximum rigidbodys!");
       return utils::CWeakPtr<CRigidbody>();
     }
-    return m_lstRigidbodys.Create(_eRigidbodyType);
+
+    utils::CWeakPtr<CRigidbody> wpRigidbody = m_lstRigidbodys.Create(_eRigidbodyType, _pOwner);
+    wpRigidbody->BindLanes(&m_oLanes, m_oLanes.Add(wpRigidbody.GetPtr()));
+    return wpRigidbody;
   }
   // ------------------------------------
   bool CPhysicsManager::DestroyRigidbody(utils::CWeakPtr<CRigidbody> _wpRigidbody)
   {
+    if (_wpRigidbody.IsValid())
+    {
+      m_oLanes.Remove(_wpRigidbody->GetLaneIdx());
+    }
     return m_lstRigidbodys.Remove(_wpRigidbody);
   }
   // ------------------------------------
+  void CPhysicsManager::SaveSnapshot(TSnapshot& _rSnapshot_) const
+  {
+    static_assert(std::is_trivially_copyable_v<CRigidbodyLanes> && std::is_trivially_copyable_v<CRigidbody>, "Snapshots are plain copies");
+    _rSnapshot_.Lanes = m_oLanes;
+    for (uint32_t uLaneIdx = 0; uLaneIdx < m_oLanes.GetCount(); ++uLaneIdx)
+    {
+      _rSnapshot_.Rigidbodys[uLaneIdx] = *m_oLanes.GetRigidbody(uLaneIdx);
+    }
+    _rSnapshot_.ContactSolver.CopyState(m_oContactSolver);
+  }
+  // ------------------------------------
+  bool CPhysicsManager::RestoreSnapshot(const TSnapshot& _rSnapshot)
+  {
+    if (!IsSnapshotValid(_rSnapshot))
+    {
+      return false;
+    }
+
+    m_oLanes = _rSnapshot.Lanes;
+    for (uint32_t uLaneIdx = 0; uLaneIdx < m_oLanes.GetCount(); ++uLaneIdx)
+    {
+      *m_oLanes.GetRigidbody(uLaneIdx) = _rSnapshot.Rigidbodys[uLaneIdx];
+    }
+    m_oContactSolver.CopyState(_rSnapshot.ContactSolver);
+
+    // Islands are rebuilt at the next update, the last motions belong to the discarded steps
+    m_lstMotions.clear();
+    return true;
+  }
+  // ------------------------------------
+  bool CPhysicsManager::IsSnapshotValid(const TSnapshot& _rSnapshot) const
+  {
+    // Same bodies in the same lanes
+    if (_rSnapshot.Lanes.GetCount() != m_oLanes.GetCount())
+    {
+      return false;
+    }
+    for (uint32_t uLaneIdx = 0; uLaneIdx < m_oLanes.GetCount(); ++uLaneIdx)
+    {
+      if (_rSnapshot.Lanes.GetRigidbody(uLaneIdx) != m_oLanes.GetRigidbody(uLaneIdx))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+  // ------------------------------------
   void CPhysicsManager::Clear()
   {
+    m_oContactSolver.Clear();
+    m_oIslands.Clear();
+    m_oLanes.Clear();
+    m_lstMotions.clear();
     m_lstRigidbodys.Clear();
   }
 }
\ No newline at end of file
@@ -3,8 +3,10 @@
 #include "Libs/Utils/FixedPool.h"
 #include "Libs/Math/Vector3.h"
 #include "Rigidbody.h"
-
-namespace game { class CEntity; }
+#include "ContactSolver.h"
+#include "Islands.h"
+#include "RigidbodyLanes.h"
+#include <vector>
 
 namespace physics
 {
@@ -13,18 +15,67 @@ namespace physics
   public:
     static const uint32_t s_uMaxRigidbodys = 250;
     typedef utils::CFixedPool<CRigidbody, s_uMaxRigidbodys> TRigidbodysList;
+    static_assert(s_uMaxRigidbodys <= CRigidbodyLanes::s_uMaxBodies, "Every rigidbody needs a lane");
+
+    // Motion of a dynamic body during the last step, applied by the owner in one pass
+    struct TMotion
+    {
+      void* Owner = nullptr;
+      math::CVector3 Displacement = math::CVector3::Zero;
+      math::CVector3 Rotation = math::CVector3::Zero; // Euler degrees
+    };
+    typedef std::vector<TMotion> TMotionList;
+
+    // An island sleeps once all its bodies stayed below these velocities for the sleep time
+    static constexpr float s_fSleepLinearVelocity = 0.05f;
+    static constexpr float s_fSleepAngularVelocity = 0.05f;
+    static constexpr float s_fTimeToSleep = 0.5f;
+    // Bodies faster than this are swept against the static world (speculative contacts)
+    static constexpr float s_fDefaultContinuousVelocity = 10.0f;
+
+    // Whole simulation state, plain copies (nothing is allocated once the manifold list has grown).
+    // Only valid for the bodies that existed when it was saved
+    struct TSnapshot
+    {
+      CRigidbodyLanes Lanes;
+      CRigidbody Rigidbodys[CRigidbodyLanes::s_uMaxBodies]; // Lane order
+      CContactSolver ContactSolver; // Warm start manifolds
+    };
 
     CPhysicsManager() {}
     ~CPhysicsManager();
 
+    // Forces (SIMD lanes), contact impulses (last collision step) and then the motions
     void Update(float _fDeltaTime);
+    // Bodies that moved during the last update (dense, lane order)
+    inline const TMotionList& GetMotions() const { return m_lstMotions; }
 
-    utils::CWeakPtr<CRigidbody> CreateRigidbody(ERigidbodyType _eRigidbodyType = ERigidbodyType::KINEMATIC);
+    utils::CWeakPtr<CRigidbody> CreateRigidbody(ERigidbodyType _eRigidbodyType = ERigidbodyType::KINEMATIC, void* _pOwner = nullptr);
     bool DestroyRigidbody(utils::CWeakPtr<CRigidbody> _wpRigidbody);
 
+    // Rollback: false if rigidbodys were created or destroyed since the save (nothing is restored)
+    void SaveSnapshot(TSnapshot& _rSnapshot_) const;
+    bool RestoreSnapshot(const TSnapshot& _rSnapshot);
+    bool IsSnapshotValid(const TSnapshot& _rSnapshot) const;
+
+    inline void SetVelocityIterations(uint32_t _uIterations) { m_oContactSolver.SetVelocityIterations(_uIterations); }
+    inline const uint32_t& GetVelocityIterations() const { return m_oContactSolver.GetVelocityIterations(); }
+
+    inline void SetContinuousVelocity(float _fVelocity) { m_fContinuousVelocity = _fVelocity; }
+    inline const float& GetContinuousVelocity() const { return m_fContinuousVelocity; }
+
   private:
+    void UpdateInertiaTensors();
+    void UpdateSleeping(float _fDeltaTime);
+    void SolveContinuousCollisions(float _fDeltaTime);
     void Clear();
+
     TRigidbodysList m_lstRigidbodys;
+    CRigidbodyLanes m_oLanes; // Body state, same bodies as the pool
+    CContactSolver m_oContactSolver;
+    CIslands m_oIslands;
+    TMotionList m_lstMotions;
+    float m_fContinuousVelocity = s_fDefaultContinuousVelocity;
   };
 }
 
@@ -10,13 +10,69 @@ namespace physics
 
     // Set new state
     m_eRigidbodyType = _eRigidbodyType;
+    WakeUp();
+  }
+  // ------------------------------------
+  void CRigidbody::WakeUp()
+  {
+    m_bSleeping = false;
+    m_fSleepTime = 0.0f;
+    RefreshActiveLane();
+  }
+  // ------------------------------------
+  void CRigidbody::SetVelocity(const math::CVector3& _v3Velocity)
+  {
+    m_pLanes->SetVector(CRigidbodyLanes::VELOCITY_X, m_uLaneIdx, _v3Velocity);
+    if (m_bSleeping && !_v3Velocity.IsZero())
+    {
+      WakeUp();
+    }
+  }
+  // ------------------------------------
+  void CRigidbody::SetAngularVelocity(const math::CVector3& _v3Velocity)
+  {
+    m_pLanes->SetVector(CRigidbodyLanes::ANGULAR_VELOCITY_X, m_uLaneIdx, _v3Velocity);
+    if (m_bSleeping && !_v3Velocity.IsZero())
+    {
+      WakeUp();
+    }
+  }
+  // ------------------------------------
+  void CRigidbody::SetCurrentState(ERigidbodyState _eRigidbodyState)
+  {
+    m_eRidibodyState = _eRigidbodyState;
+    m_pLanes->Get(CRigidbodyLanes::DRAG, m_uLaneIdx) = m_eRidibodyState == ERigidbodyState::IN_THE_AIR ? s_fAirDrag : s_fContactDrag;
+  }
+  // ------------------------------------
+  void CRigidbody::SetMass(float _fValue)
+  {
+    if (m_fMass > 0.0f && _fValue > 0.0f)
+    {
+      m_oInertia = m_oInertia * (_fValue / m_fMass);
+      m_oInvInertia = m_oInertia.Inverse();
+    }
+    m_fMass = _fValue;
+    m_pLanes->Get(CRigidbodyLanes::INV_MASS, m_uLaneIdx) = m_fMass > 0.0f ? 1.0f / m_fMass : 0.0f;
+    RefreshInertiaLanes(math::CMatrix4x4::Identity);
+  }
+  // ------------------------------------
+  void CRigidbody::SetMassProperties(const TMassProperties& _oMassProperties)
+  {
+    m_fMass = _oMassProperties.Mass;
+    m_oInertia = _oMassProperties.Inertia;
+    m_oInvInertia = m_oInertia.Inverse();
+    m_v3CenterOfMass = _oMassProperties.CenterOfMass;
+    m_pLanes->Get(CRigidbodyLanes::INV_MASS, m_uLaneIdx) = m_fMass > 0.0f ? 1.0f / m_fMass : 0.0f;
+    RefreshInertiaLanes(math::CMatrix4x4::Identity);
   }
   // ------------------------------------
   void CRigidbody::AddForce(const math::CVector3& _v3Force)
   {
     if (m_fMass > 0.0f)
     {
-      m_v3Acceleration += _v3Force / m_fMass;
+      math::CVector3 v3Acceleration = GetAcceleration() + (_v3Force / m_fMass);
+      m_pLanes->SetVector(CRigidbodyLanes::ACCELERATION_X, m_uLaneIdx, v3Acceleration);
+      WakeUp();
     }
   }
   // ------------------------------------
@@ -24,7 +80,39 @@ namespace physics
   {
     if (m_fMass > 0.0f)
     {
-      m_v3Torque += _v3Torque;
+      m_pLanes->SetVector(CRigidbodyLanes::TORQUE_X, m_uLaneIdx, GetTorque() + _v3Torque);
+      WakeUp();
     }
   }
-}
\ No newline at end of file
+  // ------------------------------------
+  void CRigidbody::BindLanes(CRigidbodyLanes* _pLanes, uint32_t _uLaneIdx)
+  {
+    m_pLanes = _pLanes;
+    m_uLaneIdx = _uLaneIdx;
+
+    // Initial state
+    m_pLanes->Get(CRigidbodyLanes::INV_MASS, m_uLaneIdx) = m_fMass > 0.0f ? 1.0f / m_fMass : 0.0f;
+    RefreshInertiaLanes(math::CMatrix4x4::Identity);
+    m_pLanes->Get(CRigidbodyLanes::DRAG, m_uLaneIdx) = m_eRidibodyState == ERigidbodyState::IN_THE_AIR ? s_fAirDrag : s_fContactDrag;
+    RefreshActiveLane();
+  }
+  // ------------------------------------
+  void CRigidbody::Sleep()
+  {
+    m_bSleeping = true;
+    m_pLanes->SetVector(CRigidbodyLanes::VELOCITY_X, m_uLaneIdx, math::CVector3::Zero);
+    m_pLanes->SetVector(CRigidbodyLanes::ANGULAR_VELOCITY_X, m_uLaneIdx, math::CVector3::Zero);
+    RefreshActiveLane();
+  }
+  // ------------------------------------
+  void CRigidbody::RefreshActiveLane()
+  {
+    bool bActive = m_eRigidbodyType == ERigidbodyType::DYNAMIC && !m_bSleeping;
+    m_pLanes->Get(CRigidbodyLanes::ACTIVE, m_uLaneIdx) = bActive ? 1.0f : 0.0f;
+  }
+  // ------------------------------------
+  void CRigidbody::RefreshInertiaLanes(const math::CMatrix4x4& _mRot)
+  {
+    m_pLanes->SetInvInertia(m_uLaneIdx, m_fMass > 0.0f ? m_oInvInertia.Rotate(_mRot) : TInertiaTensor());
+  }
+}
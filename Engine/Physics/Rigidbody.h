@@ -1,7 +1,8 @@
 #pragma once
 #include "Libs/Math/Vector3.h"
-#include "Libs/Utils/Delegate.h"
 #include "Engine/Collisions/Collider.h"
+#include "RigidbodyLanes.h"
+#include "MassProperties.h"
 
 namespace physics
 {
@@ -11,56 +12,79 @@ namespace physics
   class CRigidbody
   {
   public:
-    typedef utils::CDelegate<void(const math::CVector3&)> TOnVelocityChangedDelegate;
-    typedef utils::CDelegate<void(const math::CVector3&)> TOnRotationChangedDelegate;
+    static constexpr float s_fAirDrag = 0.1f;
+    static constexpr float s_fContactDrag = 0.2f;
 
   public:
-    CRigidbody(const ERigidbodyType _eRigidbodyType = ERigidbodyType::KINEMATIC) : m_eRigidbodyType(_eRigidbodyType) {}
-    ~CRigidbody() {}
+    CRigidbody(const ERigidbodyType _eRigidbodyType = ERigidbodyType::KINEMATIC, void* _pOwner = nullptr) : m_pOwner(_pOwner), m_eRigidbodyType(_eRigidbodyType) {}
 
     void SetRigidbodyType(ERigidbodyType _eRigidbodyType);
     inline const ERigidbodyType& GetRigidbodyType() const { return m_eRigidbodyType; }
-    inline void SetCurrentState(ERigidbodyState _eRigidbodyState) { m_eRidibodyState = _eRigidbodyState; }
+    void SetCurrentState(ERigidbodyState _eRigidbodyState);
     inline const ERigidbodyState& GetRigidbodyState() const { return m_eRidibodyState; }
 
+    // Sleeping bodies are not integrated and their colliders are frozen (forces and new velocities wake them up)
+    void WakeUp();
+    inline const bool IsSleeping() const { return m_bSleeping; }
+
+    // State lives in the lanes of the physics manager
     void AddForce(const math::CVector3& _v3Force);
-    inline const math::CVector3& GetAcceleration() { return m_v3Acceleration; }
+    inline math::CVector3 GetAcceleration() const { return m_pLanes->GetVector(CRigidbodyLanes::ACCELERATION_X, m_uLaneIdx); }
     void AddTorque(const math::CVector3& _v3Torque);
-    inline const math::CVector3& GetTorque() const { return m_v3Torque; }
+    inline math::CVector3 GetTorque() const { return m_pLanes->GetVector(CRigidbodyLanes::TORQUE_X, m_uLaneIdx); }
 
-    inline void SetAngularVelocity(const math::CVector3& _v3Velocity) { m_v3AngularVelocity = _v3Velocity; }
-    inline const math::CVector3& GetAngularVelocity() const { return m_v3AngularVelocity; }
-    inline void SetVelocity(const math::CVector3& _v3Velocity) { m_v3Velocity = _v3Velocity; }
-    inline const math::CVector3& GetVelocity() { return m_v3Velocity; }
+    void SetAngularVelocity(const math::CVector3& _v3Velocity);
+    inline math::CVector3 GetAngularVelocity() const { return m_pLanes->GetVector(CRigidbodyLanes::ANGULAR_VELOCITY_X, m_uLaneIdx); }
+    void SetVelocity(const math::CVector3& _v3Velocity);
+    inline math::CVector3 GetVelocity() const { return m_pLanes->GetVector(CRigidbodyLanes::VELOCITY_X, m_uLaneIdx); }
 
-    inline void SetMass(float _fValue) { m_fMass = _fValue; }
+    // Inertia keeps its shape (scaled with the mass)
+    void SetMass(float _fValue);
     inline const float GetMass() const { return m_fMass; }
+    // Usually from the collider shape (see ComputeMassProperties)
+    void SetMassProperties(const TMassProperties& _oMassProperties);
+    inline const TInertiaTensor& GetInertia() const { return m_oInertia; }
+    inline const math::CVector3& GetCenterOfMass() const { return m_v3CenterOfMass; }
+    inline const uint32_t& GetLaneIdx() const { return m_uLaneIdx; }
+
+    // Contact material (pairs use the max restitution and the mean friction)
+    inline void SetRestitution(float _fValue) { m_fRestitution = _fValue; }
+    inline const float GetRestitution() const { return m_fRestitution; }
+    inline void SetFriction(float _fValue) { m_fFriction = _fValue; }
+    inline const float GetFriction() const { return m_fFriction; }
 
-    // Notifications
-    void SetOnVelocityChangedDelegate(const TOnVelocityChangedDelegate& _oDelegate) { m_OnVelocityChangedDelegate = _oDelegate; }
-    void SetOnRotationChangedDelegate(const TOnRotationChangedDelegate& _oDelegate) { m_OnRotationChangedDelegate = _oDelegate; }
+    // Receives the motion of every step (see CPhysicsManager::GetMotions)
+    inline void* GetOwner() const { return m_pOwner; }
 
   private:
     friend class CPhysicsManager;
+    friend class CRigidbodyLanes;
 
-  private:
-    math::CVector3 m_v3Velocity = math::CVector3::Zero;
-    math::CVector3 m_v3AngularVelocity = math::CVector3::Zero;
+    void BindLanes(CRigidbodyLanes* _pLanes, uint32_t _uLaneIdx);
+    void Sleep();
+    void RefreshActiveLane();
+    // World space inverse tensor for the current rotation
+    void RefreshInertiaLanes(const math::CMatrix4x4& _mRot);
 
-    math::CVector3 m_v3Acceleration = math::CVector3::Zero;
-    math::CVector3 m_v3Torque = math::CVector3::Zero;
+  private:
+    CRigidbodyLanes* m_pLanes = nullptr;
+    uint32_t m_uLaneIdx = 0;
 
-    TOnVelocityChangedDelegate m_OnVelocityChangedDelegate;
-    TOnRotationChangedDelegate m_OnRotationChangedDelegate;
+    void* m_pOwner = nullptr;
 
     ERigidbodyType m_eRigidbodyType = ERigidbodyType::KINEMATIC;
     ERigidbodyState m_eRidibodyState = ERigidbodyState::IN_THE_AIR;
 
-    float m_fInertia = 1.0f;
     float m_fMass = 1.0f;
+    TInertiaTensor m_oInertia = TInertiaTensor::CreateDiagonal(math::CVector3(1.0f, 1.0f, 1.0f) / 6.0f); // Unit box, collider space
+    TInertiaTensor m_oInvInertia = TInertiaTensor::CreateDiagonal(math::CVector3(6.0f, 6.0f, 6.0f));
+    math::CVector3 m_v3CenterOfMass = math::CVector3::Zero; // Offset from the collider position
+
+    float m_fRestitution = 0.2f;
+    float m_fFriction = 0.5f;
 
-    float m_fLinearDrag = 0.01f;
-    float m_fAngularDrag = 0.01f;
+    float m_fSleepTime = 0.0f; // Time below the sleep velocities
+    bool m_bSleeping = false;
   };
 }
 
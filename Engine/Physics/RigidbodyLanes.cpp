@@ -0,0 +1,155 @@
+#include "RigidbodyLanes.h"
+#include "Rigidbody.h"
+#include <immintrin.h>
+#include <cstring>
+#include <cassert>
+
+namespace physics
+{
+  namespace internal_rigidbody_lanes
+  {
+    // Drag factor: exp(-x) ~ (12 - 6x) / (12 + 6x) (Padé approximant)
+    inline float ComputeDragFactor(float _fCoefficient, float _fDeltaTime)
+    {
+      const float fValue = 6.0f * (_fCoefficient * _fDeltaTime);
+      return (12.0f - fValue) / (12.0f + fValue);
+    }
+
+    inline __m256 ComputeDragFactor(__m256 _vCoefficient, __m256 _vDeltaTime)
+    {
+      const __m256 vValue = _mm256_mul_ps(_mm256_set1_ps(6.0f), _mm256_mul_ps(_vCoefficient, _vDeltaTime));
+      return _mm256_div_ps(_mm256_sub_ps(_mm256_set1_ps(12.0f), vValue), _mm256_add_ps(_mm256_set1_ps(12.0f), vValue));
+    }
+  }
+  // ------------------------------------
+  uint32_t CRigidbodyLanes::Add(CRigidbody* _pRigidbody)
+  {
+#ifdef _DEBUG
+    assert(m_uCount < s_uMaxBodies);
+#endif
+    uint32_t uLaneIdx = m_uCount++;
+    for (uint32_t uLane = 0; uLane < ELane::COUNT; ++uLane)
+    {
+      m_lstLanes[uLane][uLaneIdx] = 0.0f;
+    }
+    m_lstRigidbodys[uLaneIdx] = _pRigidbody;
+    return uLaneIdx;
+  }
+  // ------------------------------------
+  void CRigidbodyLanes::Remove(uint32_t _uLaneIdx)
+  {
+#ifdef _DEBUG
+    assert(_uLaneIdx < m_uCount);
+#endif
+    // Last body takes the free lane
+    uint32_t uLastIdx = --m_uCount;
+    if (_uLaneIdx != uLastIdx)
+    {
+      for (uint32_t uLane = 0; uLane < ELane::COUNT; ++uLane)
+      {
+        m_lstLanes[uLane][_uLaneIdx] = m_lstLanes[uLane][uLastIdx];
+      }
+      m_lstRigidbodys[_uLaneIdx] = m_lstRigidbodys[uLastIdx];
+      m_lstRigidbodys[_uLaneIdx]->m_uLaneIdx = _uLaneIdx;
+    }
+
+    // Unused lanes stay at zero (never integrated)
+    for (uint32_t uLane = 0; uLane < ELane::COUNT; ++uLane)
+    {
+      m_lstLanes[uLane][uLastIdx] = 0.0f;
+    }
+    m_lstRigidbodys[uLastIdx] = nullptr;
+  }
+  // ------------------------------------
+  void CRigidbodyLanes::Clear()
+  {
+    std::memset(m_lstLanes, 0, sizeof(m_lstLanes));
+    std::memset(m_lstRigidbodys, 0, sizeof(m_lstRigidbodys));
+    m_uCount = 0;
+  }
+  // ------------------------------------
+  void CRigidbodyLanes::Integrate(float _fDeltaTime, const math::CVector3& _v3Gravity)
+  {
+    const __m256 vDeltaTime = _mm256_set1_ps(_fDeltaTime);
+    const __m256 vZero = _mm256_setzero_ps();
+    const __m256 vGravity[3] = { _mm256_set1_ps(_v3Gravity.x), _mm256_set1_ps(_v3Gravity.y), _mm256_set1_ps(_v3Gravity.z) };
+
+    // Unused lanes are zero (inactive), no tail handling
+    for (uint32_t uIndex = 0; uIndex < m_uCount; uIndex += s_uLaneWidth)
+    {
+      const __m256 vActive = _mm256_cmp_ps(_mm256_load_ps(&m_lstLanes[ELane::ACTIVE][uIndex]), vZero, _CMP_NEQ_OQ);
+      const __m256 vDrag = internal_rigidbody_lanes::ComputeDragFactor(_mm256_load_ps(&m_lstLanes[ELane::DRAG][uIndex]), vDeltaTime);
+
+      // Angular acceleration = invI * t (world tensor)
+      __m256 vTorque[3];
+      for (uint32_t uAxis = 0; uAxis < 3; ++uAxis)
+      {
+        vTorque[uAxis] = _mm256_load_ps(&m_lstLanes[ELane::TORQUE_X + uAxis][uIndex]);
+      }
+      const __m256 vInvXX = _mm256_load_ps(&m_lstLanes[ELane::INV_INERTIA_XX][uIndex]);
+      const __m256 vInvYY = _mm256_load_ps(&m_lstLanes[ELane::INV_INERTIA_YY][uIndex]);
+      const __m256 vInvZZ = _mm256_load_ps(&m_lstLanes[ELane::INV_INERTIA_ZZ][uIndex]);
+      const __m256 vInvXY = _mm256_load_ps(&m_lstLanes[ELane::INV_INERTIA_XY][uIndex]);
+      const __m256 vInvXZ = _mm256_load_ps(&m_lstLanes[ELane::INV_INERTIA_XZ][uIndex]);
+      const __m256 vInvYZ = _mm256_load_ps(&m_lstLanes[ELane::INV_INERTIA_YZ][uIndex]);
+      const __m256 vAngularAcceleration[3] =
+      {
+        _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vInvXX, vTorque[0]), _mm256_mul_ps(vInvXY, vTorque[1])), _mm256_mul_ps(vInvXZ, vTorque[2])),
+        _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vInvXY, vTorque[0]), _mm256_mul_ps(vInvYY, vTorque[1])), _mm256_mul_ps(vInvYZ, vTorque[2])),
+        _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vInvXZ, vTorque[0]), _mm256_mul_ps(vInvYZ, vTorque[1])), _mm256_mul_ps(vInvZZ, vTorque[2]))
+      };
+
+      for (uint32_t uAxis = 0; uAxis < 3; ++uAxis)
+      {
+        float* pVelocity = &m_lstLanes[ELane::VELOCITY_X + uAxis][uIndex];
+        float* pAngularVelocity = &m_lstLanes[ELane::ANGULAR_VELOCITY_X + uAxis][uIndex];
+        float* pAcceleration = &m_lstLanes[ELane::ACCELERATION_X + uAxis][uIndex];
+        float* pTorque = &m_lstLanes[ELane::TORQUE_X + uAxis][uIndex];
+
+        // v = (v + (a + g) * dt) * drag
+        const __m256 vAcceleration = _mm256_load_ps(pAcceleration);
+        const __m256 vVelocity = _mm256_load_ps(pVelocity);
+        __m256 vNewVelocity = _mm256_add_ps(vVelocity, _mm256_mul_ps(_mm256_add_ps(vAcceleration, vGravity[uAxis]), vDeltaTime));
+        vNewVelocity = _mm256_mul_ps(vNewVelocity, vDrag);
+
+        // w = (w + (invI * t) * dt) * drag
+        const __m256 vAngularVelocity = _mm256_load_ps(pAngularVelocity);
+        __m256 vNewAngularVelocity = _mm256_add_ps(vAngularVelocity, _mm256_mul_ps(vAngularAcceleration[uAxis], vDeltaTime));
+        vNewAngularVelocity = _mm256_mul_ps(vNewAngularVelocity, vDrag);
+
+        // Kinematic + sleeping lanes keep their values
+        _mm256_store_ps(pVelocity, _mm256_blendv_ps(vVelocity, vNewVelocity, vActive));
+        _mm256_store_ps(pAngularVelocity, _mm256_blendv_ps(vAngularVelocity, vNewAngularVelocity, vActive));
+        _mm256_store_ps(pAcceleration, _mm256_blendv_ps(vAcceleration, vZero, vActive));
+        _mm256_store_ps(pTorque, _mm256_blendv_ps(vTorque[uAxis], vZero, vActive));
+      }
+    }
+  }
+  // ------------------------------------
+  void CRigidbodyLanes::IntegrateScalar(float _fDeltaTime, const math::CVector3& _v3Gravity)
+  {
+    for (uint32_t uIndex = 0; uIndex < m_uCount; ++uIndex)
+    {
+      if (m_lstLanes[ELane::ACTIVE][uIndex] == 0.0f)
+      {
+        continue;
+      }
+
+      const float fDrag = internal_rigidbody_lanes::ComputeDragFactor(m_lstLanes[ELane::DRAG][uIndex], _fDeltaTime);
+      const math::CVector3 v3AngularAcceleration = GetInvInertia(uIndex) * GetVector(ELane::TORQUE_X, uIndex);
+      for (uint32_t uAxis = 0; uAxis < 3; ++uAxis)
+      {
+        float& fVelocity = m_lstLanes[ELane::VELOCITY_X + uAxis][uIndex];
+        float& fAcceleration = m_lstLanes[ELane::ACCELERATION_X + uAxis][uIndex];
+        fVelocity = fVelocity + ((fAcceleration + _v3Gravity[uAxis]) * _fDeltaTime);
+        fVelocity = fVelocity * fDrag;
+        fAcceleration = 0.0f;
+
+        float& fAngularVelocity = m_lstLanes[ELane::ANGULAR_VELOCITY_X + uAxis][uIndex];
+        fAngularVelocity = fAngularVelocity + (v3AngularAcceleration[uAxis] * _fDeltaTime);
+        fAngularVelocity = fAngularVelocity * fDrag;
+        m_lstLanes[ELane::TORQUE_X + uAxis][uIndex] = 0.0f;
+      }
+    }
+  }
+}
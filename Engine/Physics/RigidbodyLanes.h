@@ -0,0 +1,78 @@
+#pragma once
+#include "Libs/Math/Vector3.h"
+#include "MassProperties.h"
+#include <cstdint>
+
+namespace physics { class CRigidbody; }
+
+namespace physics
+{
+  // Rigidbody state as structure of arrays (one lane per body), integrated 8 bodies per AVX iteration.
+  // Bodies are kept dense: removing one moves the last body to its lane.
+  class CRigidbodyLanes
+  {
+  public:
+    static constexpr uint32_t s_uLaneWidth = 8u;
+    static constexpr uint32_t s_uMaxBodies = 256u; // Multiple of the lane width
+
+    enum ELane : uint32_t
+    {
+      VELOCITY_X, VELOCITY_Y, VELOCITY_Z,
+      ANGULAR_VELOCITY_X, ANGULAR_VELOCITY_Y, ANGULAR_VELOCITY_Z,
+      ACCELERATION_X, ACCELERATION_Y, ACCELERATION_Z,
+      TORQUE_X, TORQUE_Y, TORQUE_Z,
+      INV_MASS,
+      INV_INERTIA_XX, INV_INERTIA_YY, INV_INERTIA_ZZ, // World space inverse inertia tensor (symmetric)
+      INV_INERTIA_XY, INV_INERTIA_XZ, INV_INERTIA_YZ,
+      DRAG, // Exponential drag coefficient
+      ACTIVE, // 1 = integrated (dynamic + awake), 0 = kinematic or sleeping
+      COUNT
+    };
+
+  public:
+    CRigidbodyLanes() {}
+
+    uint32_t Add(CRigidbody* _pRigidbody);
+    void Remove(uint32_t _uLaneIdx);
+    void Clear();
+
+    // Forces -> velocities, forces are consumed
+    void Integrate(float _fDeltaTime, const math::CVector3& _v3Gravity);
+    // Reference path, the SIMD path must match it bit by bit (Tests/Physics/RigidbodyLanesTests.cpp)
+    void IntegrateScalar(float _fDeltaTime, const math::CVector3& _v3Gravity);
+
+    inline float& Get(ELane _eLane, uint32_t _uLaneIdx) { return m_lstLanes[_eLane][_uLaneIdx]; }
+    inline const float& Get(ELane _eLane, uint32_t _uLaneIdx) const { return m_lstLanes[_eLane][_uLaneIdx]; }
+    inline math::CVector3 GetVector(ELane _eFirstLane, uint32_t _uLaneIdx) const
+    {
+      return math::CVector3(m_lstLanes[_eFirstLane][_uLaneIdx], m_lstLanes[_eFirstLane + 1][_uLaneIdx], m_lstLanes[_eFirstLane + 2][_uLaneIdx]);
+    }
+    inline void SetVector(ELane _eFirstLane, uint32_t _uLaneIdx, const math::CVector3& _v3Value)
+    {
+      m_lstLanes[_eFirstLane][_uLaneIdx] = _v3Value.x;
+      m_lstLanes[_eFirstLane + 1][_uLaneIdx] = _v3Value.y;
+      m_lstLanes[_eFirstLane + 2][_uLaneIdx] = _v3Value.z;
+    }
+
+    inline TInertiaTensor GetInvInertia(uint32_t _uLaneIdx) const
+    {
+      TInertiaTensor oTensor = TInertiaTensor();
+      oTensor.XX = m_lstLanes[INV_INERTIA_XX][_uLaneIdx]; oTensor.YY = m_lstLanes[INV_INERTIA_YY][_uLaneIdx]; oTensor.ZZ = m_lstLanes[INV_INERTIA_ZZ][_uLaneIdx];
+      oTensor.XY = m_lstLanes[INV_INERTIA_XY][_uLaneIdx]; oTensor.XZ = m_lstLanes[INV_INERTIA_XZ][_uLaneIdx]; oTensor.YZ = m_lstLanes[INV_INERTIA_YZ][_uLaneIdx];
+      return oTensor;
+    }
+    inline void SetInvInertia(uint32_t _uLaneIdx, const TInertiaTensor& _oTensor)
+    {
+      m_lstLanes[INV_INERTIA_XX][_uLaneIdx] = _oTensor.XX; m_lstLanes[INV_INERTIA_YY][_uLaneIdx] = _oTensor.YY; m_lstLanes[INV_INERTIA_ZZ][_uLaneIdx] = _oTensor.ZZ;
+      m_lstLanes[INV_INERTIA_XY][_uLaneIdx] = _oTensor.XY; m_lstLanes[INV_INERTIA_XZ][_uLaneIdx] = _oTensor.XZ; m_lstLanes[INV_INERTIA_YZ][_uLaneIdx] = _oTensor.YZ;
+    }
+
+    inline CRigidbody* GetRigidbody(uint32_t _uLaneIdx) const { return m_lstRigidbodys[_uLaneIdx]; }
+    inline const uint32_t& GetCount() const { return m_uCount; }
+
+  private:
+    alignas(32) float m_lstLanes[ELane::COUNT][s_uMaxBodies] = {};
+    CRigidbody* m_lstRigidbodys[s_uMaxBodies] = {};
+    uint32_t m_uCount = 0;
+  };
+}
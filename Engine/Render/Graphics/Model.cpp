@@ -85,6 +85,19 @@ namespace render
       }
     }
     // ------------------------------------
+    void CModel::SetPosRot(const math::CVector3& _v3Pos, const math::CVector3& _v3Rot)
+    {
+      // Set pos + rot
+      m_oTransform.SetPos(_v3Pos);
+      m_oTransform.SetRot(_v3Rot);
+
+      // Update bounding box
+      if (m_bCullEnabled)
+      {
+        collision::ComputeWorldAABB(m_oLocalAABB, m_oTransform, m_oWorldAABB);
+      }
+    }
+    // ------------------------------------
     void CModel::SetScl(const math::CVector3& _v3Scl)
     {
       // Set scale
@@ -139,17 +152,17 @@ namespace render
     // ------------------------------------
     bool CModel::RemoveInstance(utils::CWeakPtr<render::gfx::CRenderInstance> _pInstance_)
     {
-      bool bOk = m_lstInstances.Remove(_pInstance_);
+      size_t tIndex = m_lstInstances.FindIndex(_pInstance_);
+      bool bOk = m_lstInstances.RemoveAt(tIndex);
       UNUSED_VAR(bOk);
 #ifdef _DEBUG
       assert(bOk);
 #endif
-      // Sort ids
-      uint16_t uSize = static_cast<uint16_t>(m_lstInstances.GetSize());
-      for (uint16_t uIndex = 0; uIndex < uSize; uIndex++)
+      // The last instance takes the removed index
+      if (bOk && tIndex < m_lstInstances.GetSize())
       {
-        utils::CWeakPtr<render::gfx::CRenderInstance> pInstance = m_lstInstances[uIndex];
-        pInstance->SetInstanceID(uIndex);
+        utils::CWeakPtr<render::gfx::CRenderInstance> pInstance = m_lstInstances[tIndex];
+        pInstance->SetInstanceID(static_cast<uint16_t>(tIndex));
       }
       return bOk;
     }
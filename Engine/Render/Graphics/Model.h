@@ -41,6 +41,7 @@ namespace render
       inline const math::CVector3& GetPosition() const { return m_oTransform.GetPos(); }
       void SetRot(const math::CVector3& _v3Rot);
       inline const math::CVector3& GetRotation() const { return m_oTransform.GetRot(); }
+      void SetPosRot(const math::CVector3& _v3Pos, const math::CVector3& _v3Rot);
       void SetScl(const math::CVector3& _v3Scl);
       inline const math::CVector3& GetScl() const { return m_oTransform.GetScl(); }
 
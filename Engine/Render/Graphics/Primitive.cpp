@@ -66,6 +66,19 @@ namespace render
       }
     }
     // ------------------------------------
+    void CPrimitive::SetPosRot(const math::CVector3& _v3Pos, const math::CVector3& _v3Rot)
+    {
+      // Set pos + rot
+      m_oTransform.SetPos(_v3Pos);
+      m_oTransform.SetRot(_v3Rot);
+
+      // Update bounding box
+      if (m_bCullEnabled)
+      {
+        collision::ComputeWorldAABB(m_oLocalAABB, m_oTransform, m_oWorldAABB);
+      }
+    }
+    // ------------------------------------
     void CPrimitive::SetScl(const math::CVector3& _v3Scl)
     {
       // Set scale
@@ -39,6 +39,19 @@ namespace render
       }
     }
     // ------------------------------------
+    void CRenderInstance::SetPosRot(const math::CVector3& _v3Pos, const math::CVector3& _v3Rot)
+    {
+      // Set pos + rot
+      m_oTransform.SetPos(_v3Pos);
+      m_oTransform.SetRot(_v3Rot);
+
+      // Update bounding box
+      if (m_bCullEnabled)
+      {
+        collision::ComputeWorldAABB(m_pParent->GetLocalAABB(), m_oTransform, m_oWorldAABB);
+      }
+    }
+    // ------------------------------------
     void CRenderInstance::SetScl(const math::CVector3& _v3Scl)
     {
       // Set scale
@@ -30,6 +30,8 @@
 #include "Libs/ImGui/imgui_impl_win32.h"
 #include "Libs/ImGui/imgui_impl_dx11.h"
 #include "Libs/ImGui/ImGuizmo.h"
+#include "Libs/Memory/Allocator.h"
+#include <cstdlib>
 #include <d3d11.h>
 
 namespace render
@@ -137,6 +139,21 @@ namespace render
     };
 
     static TRenderPipeline Pipeline;
+
+    // ImGui heap (render thread only), the blocks that do not fit in the arena go to the CRT heap
+    static constexpr size_t s_tImGuiArenaSize = 8u * 1024u * 1024u;
+    void* ImGuiAlloc(size_t _tSize, void* _pArena)
+    {
+      void* pData = static_cast<mem::CAllocator*>(_pArena)->alloc(_tSize, alignof(std::max_align_t));
+      return pData ? pData : std::malloc(_tSize);
+    }
+    void ImGuiFree(void* _pData, void* _pArena)
+    {
+      if (!static_cast<mem::CAllocator*>(_pArena)->free(_pData))
+      {
+        std::free(_pData);
+      }
+    }
   }
   // ------------------------------------
   CRender::CRender(uint32_t _uWidth, uint32_t _uHeight)
@@ -861,6 +878,10 @@ namespace render
     {
       return E_FAIL;
     }
+
+    // Before the context, every ImGui allocation comes from the arena
+    m_pImGuiArena = std::make_unique<mem::CAllocator>(internal::s_tImGuiArenaSize);
+    ImGui::SetAllocatorFunctions(&internal::ImGuiAlloc, &internal::ImGuiFree, m_pImGuiArena.get());
     if (!ImGui::CreateContext())
     {
       return E_FAIL;
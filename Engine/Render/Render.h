@@ -11,6 +11,7 @@ namespace scene { class CRenderScene; }
 namespace render { class CDeferredRenderer; }
 namespace render { class CForwardRenderer; }
 namespace render { class CLightingRenderer; }
+namespace mem { class CAllocator; }
 
 namespace render
 {
@@ -92,6 +93,9 @@ namespace render
     std::unique_ptr<CDeferredRenderer> m_pDeferredRenderer = nullptr;
     std::unique_ptr<CForwardRenderer> m_pForwardRenderer = nullptr;
     std::unique_ptr<CLightingRenderer> m_pLightingRenderer = nullptr;
+
+    // ImGui allocations (destroyed after the ImGui context)
+    std::unique_ptr<mem::CAllocator> m_pImGuiArena = nullptr;
   };
 }
 
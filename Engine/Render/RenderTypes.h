@@ -2,6 +2,7 @@
 #include "Libs/Math/Vector2.h"
 #include "Libs/Math/Vector3.h"
 #include "Libs/Math/Matrix4x4.h"
+#include "Libs/Memory/FrameAllocator.h"
 
 namespace render
 {
@@ -40,10 +41,11 @@ namespace render
     //------------------------------------------------
     //------------------PRIMITIVES--------------------
     //------------------------------------------------
+    // Frame memory, copied to the vertex/index buffers when the primitive is created
     struct TPrimitiveData
     {
-      std::vector<math::CVector3> Vertices;
-      std::vector<uint32_t> Indices;
+      mem::TFrameVector<math::CVector3> Vertices;
+      mem::TFrameVector<uint32_t> Indices;
     };
     struct TPrimitiveInstanceData
     {
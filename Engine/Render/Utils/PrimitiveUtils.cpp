@@ -169,22 +169,19 @@ namespace render
         case EPrimitive::E3D_CUBE:
         {
           // Create 3D Cube
-          rPrimitiveData.Vertices = CPrimitiveUtils::s_oCubePrimitive;
-          rPrimitiveData.Indices = _eRenderMode == (render::ERenderMode::SOLID) ? s_oCubeIndices : s_oWireframeCubeIndices;
+          const std::vector<uint32_t>& lstIndices = _eRenderMode == (render::ERenderMode::SOLID) ? s_oCubeIndices : s_oWireframeCubeIndices;
+          rPrimitiveData.Vertices.assign(CPrimitiveUtils::s_oCubePrimitive.begin(), CPrimitiveUtils::s_oCubePrimitive.end());
+          rPrimitiveData.Indices.assign(lstIndices.begin(), lstIndices.end());
         }
         break;
         case EPrimitive::E3D_SPHERE:
         {
           // Create sphere
-          std::vector<math::CVector3> lstVertices = std::vector<math::CVector3>();
-          CreateSphere(s_fStandardRadius, s_uSubvH, s_uSubvV, lstVertices);
+          CreateSphere(s_fStandardRadius, s_uSubvH, s_uSubvV, rPrimitiveData.Vertices);
 
           // Get indices
-          const std::vector<uint32_t>& lstIndices = _eRenderMode == (render::ERenderMode::SOLID) ?
+          rPrimitiveData.Indices = _eRenderMode == (render::ERenderMode::SOLID) ?
           GetSphereIndices(s_uSubvH, s_uSubvV) : GetWireframeSphereIndices(s_uSubvH, s_uSubvV);
-
-          rPrimitiveData.Vertices = lstVertices;
-          rPrimitiveData.Indices = lstIndices;
         }
         break;
         case EPrimitive::E3D_CAPSULE:
@@ -196,16 +193,18 @@ namespace render
         case EPrimitive::E3D_PLANE:
         {
           // Create 3D Plane
-          rPrimitiveData.Vertices = s_oPlanePrimitive;
-          rPrimitiveData.Indices = _eRenderMode == (render::ERenderMode::SOLID) ? s_oPlaneIndices : s_oWireframePlaneIndices;
+          const std::vector<uint32_t>& lstIndices = _eRenderMode == (render::ERenderMode::SOLID) ? s_oPlaneIndices : s_oWireframePlaneIndices;
+          rPrimitiveData.Vertices.assign(s_oPlanePrimitive.begin(), s_oPlanePrimitive.end());
+          rPrimitiveData.Indices.assign(lstIndices.begin(), lstIndices.end());
         }
         break;
         // 2D Implementation
         case EPrimitive::E2D_SQUARE:
         {
           // Create 2D Square
-          rPrimitiveData.Vertices = CPrimitiveUtils::s_oSquarePrimitive;
-          rPrimitiveData.Indices = _eRenderMode == (render::ERenderMode::SOLID) ? s_oSquareIndices : s_oSquareWireframeIndices;
+          const std::vector<uint32_t>& lstIndices = _eRenderMode == (render::ERenderMode::SOLID) ? s_oSquareIndices : s_oSquareWireframeIndices;
+          rPrimitiveData.Vertices.assign(CPrimitiveUtils::s_oSquarePrimitive.begin(), CPrimitiveUtils::s_oSquarePrimitive.end());
+          rPrimitiveData.Indices.assign(lstIndices.begin(), lstIndices.end());
         }
         break;
         case EPrimitive::E2D_CIRCLE:
@@ -217,8 +216,9 @@ namespace render
         case EPrimitive::E2D_TRIANGLE:
         {
           // Create 2D Triangle
-          rPrimitiveData.Vertices = s_oTrianglePrimitive;
-          rPrimitiveData.Indices = _eRenderMode == (render::ERenderMode::SOLID) ? s_oTriangleIndices : s_oWireframeTriangleIndices;
+          const std::vector<uint32_t>& lstIndices = _eRenderMode == (render::ERenderMode::SOLID) ? s_oTriangleIndices : s_oWireframeTriangleIndices;
+          rPrimitiveData.Vertices.assign(s_oTrianglePrimitive.begin(), s_oTrianglePrimitive.end());
+          rPrimitiveData.Indices.assign(lstIndices.begin(), lstIndices.end());
         }
         break;
       }
@@ -234,6 +234,7 @@ namespace render
     {
       // Create primitive
       TPrimitiveData rCustomData = TPrimitiveData();
+      rCustomData.Vertices.reserve(_uSegments + (_eRenderMode == ERenderMode::SOLID ? 2u : 1u));
 
       if (_eRenderMode == ERenderMode::SOLID)
       {
@@ -281,8 +282,9 @@ namespace render
     {
       // Create primitive
       TPrimitiveData rCustomPrimitive = TPrimitiveData();
-      rCustomPrimitive.Vertices = s_oPlanePrimitive;
-      rCustomPrimitive.Indices = _eRenderMode == render::ERenderMode::SOLID ? s_oPlaneIndices : s_oWireframePlaneIndices;
+      const std::vector<uint32_t>& lstIndices = _eRenderMode == render::ERenderMode::SOLID ? s_oPlaneIndices : s_oWireframePlaneIndices;
+      rCustomPrimitive.Vertices.assign(s_oPlanePrimitive.begin(), s_oPlanePrimitive.end());
+      rCustomPrimitive.Indices.assign(lstIndices.begin(), lstIndices.end());
 
       // Invert indices
       const math::CVector3& v3Normal = _oPlane.GetNormal();
@@ -339,6 +341,12 @@ namespace render
       float fHalfHeight = _fHeight * 0.5f;
       float fDiff = fHalfHeight - _fRadius;
 
+      // Reserve the final size (two semi-spheres + body)
+      const uint32_t uBodyStacks = fDiff >= 0.0f ? (_eRenderMode == render::ERenderMode::SOLID ? _uSubvH : 1u) : 0u;
+      const uint32_t uIndicesPerQuad = _eRenderMode == render::ERenderMode::SOLID ? 6u : 4u;
+      rCustomPrimitive.Vertices.reserve((((_uSubvH + 1u) * 2u) + (fDiff >= 0.0f ? uBodyStacks + 1u : 0u)) * (_uSubvV + 1u));
+      rCustomPrimitive.Indices.reserve(((_uSubvH * 2u) + uBodyStacks) * _uSubvV * uIndicesPerQuad);
+
       // Semi sphere lambda
       auto oCalcSemiSphereFunc = [&](bool _bInverse = false)
       {
@@ -456,11 +464,12 @@ namespace render
     void CPrimitiveUtils::CreateSphere
     (
       float _fRadius, uint32_t _uStacks, uint32_t _uSlices,
-      std::vector<math::CVector3>& _lstPrimitiveData_
+      mem::TFrameVector<math::CVector3>& _lstPrimitiveData_
     )
     {
       // Clear
       _lstPrimitiveData_.clear();
+      _lstPrimitiveData_.reserve((_uStacks + 1u) * (_uSlices + 1u));
 
       // Generate vertex data
       for (uint32_t uX = 0; uX <= _uStacks; ++uX)
@@ -481,9 +490,10 @@ namespace render
     }
 
     // ------------------------------------
-    std::vector<uint32_t> CPrimitiveUtils::GetSphereIndices(uint32_t _uStacks, uint32_t _uSlices)
+    mem::TFrameVector<uint32_t> CPrimitiveUtils::GetSphereIndices(uint32_t _uStacks, uint32_t _uSlices)
     {
-      std::vector<uint32_t> lstIndices = std::vector<uint32_t>();
+      mem::TFrameVector<uint32_t> lstIndices = mem::TFrameVector<uint32_t>();
+      lstIndices.reserve(_uStacks * _uSlices * 6u);
       for (uint32_t uI = 0; uI < _uStacks; ++uI)
       {
         for (uint32_t uJ = 0; uJ < _uSlices; ++uJ)
@@ -504,9 +514,10 @@ namespace render
     }
 
     // ------------------------------------
-    std::vector<uint32_t> CPrimitiveUtils::GetWireframeSphereIndices(uint32_t _uStacks, uint32_t _uSlices)
+    mem::TFrameVector<uint32_t> CPrimitiveUtils::GetWireframeSphereIndices(uint32_t _uStacks, uint32_t _uSlices)
     {
-      std::vector<uint32_t> lstWireframeIndices = std::vector<uint32_t>();
+      mem::TFrameVector<uint32_t> lstWireframeIndices = mem::TFrameVector<uint32_t>();
+      lstWireframeIndices.reserve(_uStacks * _uSlices * 4u);
       for (uint32_t uI = 0; uI < _uStacks; ++uI)
       {
         for (uint32_t uJ = 0; uJ < _uSlices; ++uJ)
@@ -531,9 +542,10 @@ namespace render
     }
 
     // ------------------------------------
-    std::vector<uint32_t> CPrimitiveUtils::GetCircleIndices(uint32_t _uSegments)
+    mem::TFrameVector<uint32_t> CPrimitiveUtils::GetCircleIndices(uint32_t _uSegments)
     {
-      std::vector<uint32_t> lstIndices = std::vector<uint32_t>();
+      mem::TFrameVector<uint32_t> lstIndices = mem::TFrameVector<uint32_t>();
+      lstIndices.reserve(_uSegments * 3u);
       for (uint32_t uX = 1; uX <= _uSegments; ++uX)
       {
         lstIndices.push_back(0);
@@ -544,9 +556,10 @@ namespace render
     }
 
     // ------------------------------------
-    std::vector<uint32_t> CPrimitiveUtils::GetWireframeCircleIndices(uint32_t _uSegments)
+    mem::TFrameVector<uint32_t> CPrimitiveUtils::GetWireframeCircleIndices(uint32_t _uSegments)
     {
-      std::vector<uint32_t> lstIndices = std::vector<uint32_t>();
+      mem::TFrameVector<uint32_t> lstIndices = mem::TFrameVector<uint32_t>();
+      lstIndices.reserve(_uSegments * 2u);
       for (uint32_t uX = 0; uX < _uSegments; ++uX)
       {
         lstIndices.push_back(uX);
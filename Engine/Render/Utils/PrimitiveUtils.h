@@ -48,13 +48,13 @@ namespace render
       static TPrimitiveData CreateCapsule(float _fRadius, float _fHeight, uint32_t _uStacks, uint32_t _iulices, render::ERenderMode _eRenderMode);
 
       // 3D Sphere
-      static void CreateSphere(float _fRadius, uint32_t _iStacks, uint32_t _uSlices, std::vector<math::CVector3>& _lstPrimitiveData_);
+      static void CreateSphere(float _fRadius, uint32_t _iStacks, uint32_t _uSlices, mem::TFrameVector<math::CVector3>& _lstPrimitiveData_);
 
-      static std::vector<uint32_t> GetSphereIndices(uint32_t _uSegments, uint32_t _uSlices);
-      static std::vector<uint32_t> GetWireframeSphereIndices(uint32_t _uStacks, uint32_t _uSlices);
+      static mem::TFrameVector<uint32_t> GetSphereIndices(uint32_t _uSegments, uint32_t _uSlices);
+      static mem::TFrameVector<uint32_t> GetWireframeSphereIndices(uint32_t _uStacks, uint32_t _uSlices);
 
-      static std::vector<uint32_t> GetCircleIndices(uint32_t _uSegments);
-      static std::vector<uint32_t> GetWireframeCircleIndices(uint32_t _uSegments);
+      static mem::TFrameVector<uint32_t> GetCircleIndices(uint32_t _uSegments);
+      static mem::TFrameVector<uint32_t> GetWireframeCircleIndices(uint32_t _uSegments);
     };
 
   }
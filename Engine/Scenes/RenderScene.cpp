@@ -8,6 +8,7 @@
 #include "Engine/Global/GlobalResources.h"
 
 #include "Libs/Macros/GlobalMacros.h"
+#include "Libs/Math/Math.h"
 #include <cassert>
 
 namespace scene
@@ -221,7 +222,7 @@ namespace scene
 
     // Set AABB
     collision::CAABB rAABB = collision::CAABB();
-    collision::ComputeLocalAABB(rPrimitiveData.Vertices, rAABB);
+    collision::ComputeLocalAABB(rPrimitiveData.Vertices.data(), rPrimitiveData.Vertices.size(), rAABB);
     pPrimitive->SetLocalAABB(rAABB);
 
     // Setup
@@ -312,65 +313,59 @@ namespace scene
 
     // Get info
     uint32_t uModelIdx = static_cast<uint32_t>(m_lstModels.FindIndex(_wpModel_));
-    uint16_t uCurrentSize = static_cast<uint16_t>(m_lstModels.GetSize());
+    const render::gfx::CModel* pRemovedModel = _wpModel_.GetPtr();
 
-    const CBufferHandler& rVtxBufferHandler = _wpModel_->GetVtxBufferHandler();
+    const CBufferHandler oVtxBufferHandler = _wpModel_->GetVtxBufferHandler();
     uint32_t uVtxDisplacement = 0;
-    m_oModelsVB.Free(rVtxBufferHandler, uVtxDisplacement);
-
-    if (uVtxDisplacement > 0)
-    {
-      uint32_t uFirstOffset = rVtxBufferHandler.BeginOffset;
-      for (uint32_t uI = (uModelIdx + 1); uI < uCurrentSize; uI++)
-      {
-        utils::CWeakPtr<render::gfx::CModel> pModel = m_lstModels[uI];
-        CBufferHandler rBufferHandler = pModel->GetVtxBufferHandler();
-
-        uint32_t uOffsetSize = rBufferHandler.GetOffset();
-        rBufferHandler.BeginOffset = uFirstOffset;
-        rBufferHandler.EndOffset = rBufferHandler.BeginOffset + uOffsetSize;
-
-        pModel->SetVtxBufferHandler(rBufferHandler);
-        uFirstOffset = rBufferHandler.EndOffset;
-      }
-    }
+    m_oModelsVB.Free(oVtxBufferHandler, uVtxDisplacement);
 
     // Get meshes
     uint16_t uCount = 0;
     render::gfx::TMeshes& lstMeshes = _wpModel_->GetMeshes(uCount);
 
     uint32_t uIdxDisplacement = 0;
-    size_t tIndex = (uCount - 1);
+    uint32_t uIdxEndOffset = 0;
     render::gfx::TMeshes::reverse_iterator it = lstMeshes.rbegin();
-    for (; it != lstMeshes.rend(); ++it, --tIndex)
+    for (; it != lstMeshes.rend(); ++it)
     {
       const CBufferHandler& rBufferHandler = it->GetIdxBufferHandler();
       if (rBufferHandler.GetOffset() <= 0) continue;
 
       uint32_t uDisplacement = 0;
+      uIdxEndOffset = math::Max(uIdxEndOffset, rBufferHandler.EndOffset);
       m_oModelsIB.Free(rBufferHandler, uDisplacement);
       uIdxDisplacement += uDisplacement;
     }
 
-    if (uIdxDisplacement > 0)
+    // The pool order does not follow the buffers (swap removal), the blocks after the removed ones are displaced
+    if (uVtxDisplacement > 0 || uIdxDisplacement > 0)
     {
-      for (uint32_t uIdx = (uModelIdx + 1); uIdx < uCurrentSize; uIdx++)
+      for (render::gfx::CModel* pModel : m_lstModels)
       {
-        uCount = 0;
-        render::gfx::TMeshes& tmpMeshes = m_lstModels[uIdx]->GetMeshes(uCount);
-
-        tIndex = (uCount - 1);
-        it = tmpMeshes.rbegin();
+        if (pModel == pRemovedModel) continue;
 
-        for (; it != tmpMeshes.rend(); ++it, --tIndex)
+        CBufferHandler oBufferHandler = pModel->GetVtxBufferHandler();
+        if (uVtxDisplacement > 0 && oBufferHandler.BeginOffset >= oVtxBufferHandler.EndOffset)
         {
-          CBufferHandler rIdxBufferHandler = it->GetIdxBufferHandler();
-          if (rIdxBufferHandler.GetOffset() <= 0) continue;
+          oBufferHandler.BeginOffset -= uVtxDisplacement;
+          oBufferHandler.EndOffset -= uVtxDisplacement;
+          pModel->SetVtxBufferHandler(oBufferHandler);
+        }
 
-          // Apply displacement
-          rIdxBufferHandler.BeginOffset -= uIdxDisplacement;
-          rIdxBufferHandler.EndOffset -= uIdxDisplacement;
-          it->SetIdxBufferHandler(rIdxBufferHandler);
+        if (uIdxDisplacement > 0)
+        {
+          uCount = 0;
+          render::gfx::TMeshes& tmpMeshes = pModel->GetMeshes(uCount);
+          for (render::gfx::CMesh& rMesh : tmpMeshes)
+          {
+            CBufferHandler oIdxBufferHandler = rMesh.GetIdxBufferHandler();
+            if (oIdxBufferHandler.GetOffset() <= 0 || oIdxBufferHandler.BeginOffset < uIdxEndOffset) continue;
+
+            // Apply displacement
+            oIdxBufferHandler.BeginOffset -= uIdxDisplacement;
+            oIdxBufferHandler.EndOffset -= uIdxDisplacement;
+            rMesh.SetIdxBufferHandler(oIdxBufferHandler);
+          }
         }
       }
     }
@@ -468,7 +463,7 @@ namespace scene
 
     // Set AABB
     collision::CAABB rAABB = collision::CAABB();
-    collision::ComputeLocalAABB(rPrimitiveData.Vertices, rAABB);
+    collision::ComputeLocalAABB(rPrimitiveData.Vertices.data(), rPrimitiveData.Vertices.size(), rAABB);
     pPrimitive->SetLocalAABB(rAABB);
 
     // Setup
@@ -519,7 +514,7 @@ namespace scene
 
     // Set AABB
     collision::CAABB rAABB = collision::CAABB();
-    collision::ComputeLocalAABB(rPrimitiveData.Vertices, rAABB);
+    collision::ComputeLocalAABB(rPrimitiveData.Vertices.data(), rPrimitiveData.Vertices.size(), rAABB);
     pPrimitive->SetLocalAABB(rAABB);
 
     // Setup
@@ -576,7 +571,7 @@ namespace scene
 
     // Set AABB
     collision::CAABB rAABB = collision::CAABB();
-    collision::ComputeLocalAABB(rPrimitiveData.Vertices, rAABB);
+    collision::ComputeLocalAABB(rPrimitiveData.Vertices.data(), rPrimitiveData.Vertices.size(), rAABB);
     pPrimitive->SetLocalAABB(rAABB);
 
     // Setup
@@ -626,7 +621,7 @@ namespace scene
 
     // Set AABB
     collision::CAABB rAABB = collision::CAABB();
-    collision::ComputeLocalAABB(rPrimitiveData.Vertices, rAABB);
+    collision::ComputeLocalAABB(rPrimitiveData.Vertices.data(), rPrimitiveData.Vertices.size(), rAABB);
     pPrimitive->SetLocalAABB(rAABB);
 
     // Setup
@@ -677,7 +672,7 @@ namespace scene
 
     // Set AABB
     collision::CAABB rAABB = collision::CAABB();
-    collision::ComputeLocalAABB(rPrimitiveData.Vertices, rAABB);
+    collision::ComputeLocalAABB(rPrimitiveData.Vertices.data(), rPrimitiveData.Vertices.size(), rAABB);
     pPrimitive->SetLocalAABB(rAABB);
 
     // Setup
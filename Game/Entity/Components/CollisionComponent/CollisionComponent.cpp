@@ -6,6 +6,7 @@
 #include "Engine/Collisions/BoxCollider.h"
 #include "Engine/Collisions/SphereCollider.h"
 #include "Engine/Collisions/CapsuleCollider.h"
+#include "Game/Entity/Components/RigidbodyComponent/RigidbodyComponent.h"
 #include <cassert>
 
 namespace game
@@ -38,6 +39,14 @@ namespace game
       m_pCollider->SetPos(pOwner->GetPos());
       m_pCollider->SetRot(pOwner->GetRot());
       m_pCollider->RecalculateCollider();
+
+      // Contact impulses
+      CRigidbodyComponent* pRigidbodyComponent = pOwner->GetComponent<CRigidbodyComponent>();
+      if (pRigidbodyComponent)
+      {
+        m_pCollider->SetRigidbody(pRigidbodyComponent->GetRigidbody());
+        pRigidbodyComponent->ComputeMassProperties();
+      }
     }
   }
   // ------------------------------------
@@ -83,6 +92,14 @@ namespace game
     SetRot(_v3Rot);
   }
   // ------------------------------------
+  void CCollisionComponent::OnTransformChanged(const math::CVector3& _v3Pos, const math::CVector3& _v3Rot)
+  {
+    // Recalculate once
+    m_pCollider->SetPos(_v3Pos);
+    m_pCollider->SetRot(_v3Rot);
+    m_pCollider->RecalculateCollider();
+  }
+  // ------------------------------------
   void CCollisionComponent::Clean()
   {
     if (m_pCollider)
@@ -32,6 +32,7 @@ namespace game
   protected:
     virtual void OnPositionChanged(const math::CVector3& _v3Pos) override;
     virtual void OnRotationChanged(const math::CVector3& _v3Rot) override;
+    virtual void OnTransformChanged(const math::CVector3& _v3Pos, const math::CVector3& _v3Rot) override;
 
 #ifdef _DEBUG
     virtual void DrawDebug() override;
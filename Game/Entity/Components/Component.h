@@ -22,6 +22,10 @@ namespace game
     virtual void OnPositionChanged(const math::CVector3&) {}
     virtual void OnRotationChanged(const math::CVector3&) {}
     virtual void OnScaleChanged(const math::CVector3&) {}
+    // Position + rotation at once (physics sync), override it to refresh the caches only once
+    virtual void OnTransformChanged(const math::CVector3& _v3Pos, const math::CVector3& _v3Rot) { OnPositionChanged(_v3Pos); OnRotationChanged(_v3Rot); }
+    // Pose interpolated between two fixed ticks, only the visuals follow it
+    virtual void OnRenderTransformChanged(const math::CVector3&, const math::CVector3&) {}
 
     virtual void OnCollisionEnter(const collision::THitEvent&) {}
     virtual void OnCollisionStay(const collision::THitEvent&) {}
@@ -134,6 +134,29 @@ namespace game
     SetRotation(_v3Rot);
   }
   // ------------------------------------
+  void CModelComponent::OnTransformChanged(const math::CVector3& _v3Pos, const math::CVector3& _v3Rot)
+  {
+    if (m_wpPrimitive.IsValid())
+    {
+      m_wpPrimitive->SetPosRot(_v3Pos, _v3Rot);
+    }
+
+    if (m_wpModel.IsValid() && !m_wpModelInstance.IsValid())
+    {
+      m_wpModel->SetPosRot(_v3Pos, _v3Rot);
+    }
+    else if (m_wpModelInstance.IsValid())
+    {
+      m_wpModelInstance->SetPosRot(_v3Pos, _v3Rot);
+    }
+  }
+  // ------------------------------------
+  void CModelComponent::OnRenderTransformChanged(const math::CVector3& _v3Pos, const math::CVector3& _v3Rot)
+  {
+    // The render items are all this component owns
+    OnTransformChanged(_v3Pos, _v3Rot);
+  }
+  // ------------------------------------
   void CModelComponent::OnScaleChanged(const math::CVector3& _v3Scale)
   {
     SetScl(_v3Scale);
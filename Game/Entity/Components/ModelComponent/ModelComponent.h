@@ -38,6 +38,8 @@ namespace game
   protected:
     virtual void OnPositionChanged(const math::CVector3& _v3Pos) override;
     virtual void OnRotationChanged(const math::CVector3& _v3Rot) override;
+    virtual void OnTransformChanged(const math::CVector3& _v3Pos, const math::CVector3& _v3Rot) override;
+    virtual void OnRenderTransformChanged(const math::CVector3& _v3Pos, const math::CVector3& _v3Rot) override;
     virtual void OnScaleChanged(const math::CVector3& _v3Scale) override;
 
   private:
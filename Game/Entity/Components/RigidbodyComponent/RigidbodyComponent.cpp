@@ -1,5 +1,6 @@
 #include "RigidbodyComponent.h"
 #include "Game/Entity/Entity.h"
+#include "Game/Entity/Components/CollisionComponent/CollisionComponent.h"
 #include "Engine/Physics/PhysicsManager.h"
 #include "Libs/Macros/GlobalMacros.h"
 #include "Libs/ImGui/imgui.h"
@@ -7,25 +8,33 @@
 
 namespace game
 {
-  namespace internal_rigidbody
-  {
-    const float s_fMaxAngularForce(50.0f);
-    const float s_fRebound(1.75f);
-  }
   // ------------------------------------
   void CRigidbodyComponent::CreateRigidbody(physics::ERigidbodyType _eRigidbodyType)
   {
     Clean();
 
-    // Create rigidbody
-    m_pRigidbody = physics::CPhysicsManager::GetInstance()->CreateRigidbody(_eRigidbodyType);
+    // Create rigidbody (the game manager applies its motions to the owner)
+    m_pRigidbody = physics::CPhysicsManager::GetInstance()->CreateRigidbody(_eRigidbodyType, GetOwner());
 #ifdef _DEBUG
     assert(m_pRigidbody.IsValid());
 #endif
 
-    // Set notifications
-    m_pRigidbody->SetOnVelocityChangedDelegate(physics::CRigidbody::TOnVelocityChangedDelegate(&CRigidbodyComponent::OnApplyVelocity, this));
-    m_pRigidbody->SetOnRotationChangedDelegate(physics::CRigidbody::TOnVelocityChangedDelegate(&CRigidbodyComponent::OnApplyRotation, this));
+    // Contact impulses
+    CCollisionComponent* pCollisionComponent = GetOwner() ? GetOwner()->GetComponent<CCollisionComponent>() : nullptr;
+    if (pCollisionComponent && pCollisionComponent->GetCollider())
+    {
+      pCollisionComponent->GetCollider()->SetRigidbody(m_pRigidbody);
+      ComputeMassProperties();
+    }
+  }
+  // ------------------------------------
+  void CRigidbodyComponent::ComputeMassProperties(float _fDensity)
+  {
+    CCollisionComponent* pCollisionComponent = GetOwner() ? GetOwner()->GetComponent<CCollisionComponent>() : nullptr;
+    if (m_pRigidbody.IsValid() && pCollisionComponent && pCollisionComponent->GetCollider())
+    {
+      m_pRigidbody->SetMassProperties(physics::ComputeMassProperties(*pCollisionComponent->GetCollider(), _fDensity));
+    }
   }
   // ------------------------------------
   void CRigidbodyComponent::SetRigidbodyType(physics::ERigidbodyType _eRigidbodyType)
@@ -35,99 +44,31 @@ namespace game
   // ------------------------------------
   void CRigidbodyComponent::OnCollisionEnter(const collision::THitEvent& _oHitEvent)
   {
-    // Set new state
-    m_pRigidbody->SetCurrentState(physics::ERigidbodyState::COLLIDING);
-
-    math::CVector3 v3CurrentVelocity = m_pRigidbody->GetVelocity();
-    math::CVector3 v3VelocityDir = math::CVector3::Normalize(v3CurrentVelocity);
-
-    // Get impact velocity
-    float fImpactVelocity = abs(v3CurrentVelocity.Dot(_oHitEvent.Normal));
-    if (fImpactVelocity > math::s_fEpsilon5)
+    // Triggers do not touch the body
+    if (_oHitEvent.Trigger)
     {
-      // Apply velocity
-      v3CurrentVelocity = v3CurrentVelocity - _oHitEvent.Normal * (-fImpactVelocity * internal_rigidbody::s_fRebound);
-      m_pRigidbody->SetVelocity(v3CurrentVelocity);
-    }
-
-    float fMagnitude = v3CurrentVelocity.Magnitude();
-    math::CVector3 v3TorqueDir = _oHitEvent.Normal.Cross(v3VelocityDir);
-    m_pRigidbody->AddTorque(v3TorqueDir * -fMagnitude * (internal_rigidbody::s_fMaxAngularForce * 2.0f));
-
-    // Fixed impacted position
-    CEntity* pOwner = GetOwner();
-    if (pOwner)
-    {
-      math::CVector3 v3Offset = _oHitEvent.Normal * _oHitEvent.Depth;
-      if (!v3Offset.Equal(math::CVector3::Zero, math::s_fEpsilon5))
-      {
-        math::CVector3 vNewPosition = pOwner->GetPos() + v3Offset;
-        pOwner->SetPos(vNewPosition);
-      }
+      return;
     }
+    // Impulses are solved by the physics manager
+    m_pRigidbody->SetCurrentState(physics::ERigidbodyState::COLLIDING);
   }
   // ------------------------------------
   void CRigidbodyComponent::OnCollisionStay(const collision::THitEvent& _oHitEvent)
   {
-    math::CVector3 v3CurrentVelocity = m_pRigidbody->GetVelocity();
-    math::CVector3 v3VelocityDir = math::CVector3::Normalize(v3CurrentVelocity);
-
-    // Get impact velocity
-    float fImpactVelocity = abs(v3CurrentVelocity.Dot(_oHitEvent.Normal));
-    if (fImpactVelocity > math::s_fEpsilon5)
+    if (_oHitEvent.Trigger)
     {
-      // Apply velocity
-      v3CurrentVelocity = v3CurrentVelocity - _oHitEvent.Normal * (-fImpactVelocity * internal_rigidbody::s_fRebound);
-      m_pRigidbody->SetVelocity(v3CurrentVelocity);
-    }
-
-    // Apply torque
-    float fMagnitude = v3CurrentVelocity.Magnitude();
-    if (fMagnitude > math::s_fEpsilon5)
-    {
-      math::CVector3 v3TorqueDir = _oHitEvent.Normal.Cross(v3VelocityDir);
-      m_pRigidbody->AddTorque(v3TorqueDir * -fMagnitude * internal_rigidbody::s_fMaxAngularForce);
-    }
-
-    // Fixed impacted position
-    CEntity* pOwner = GetOwner();
-    if (pOwner)
-    {
-      math::CVector3 v3Offset = _oHitEvent.Normal * _oHitEvent.Depth;
-      if (!v3Offset.Equal(math::CVector3::Zero, math::s_fEpsilon5))
-      {
-        math::CVector3 vNewPosition = pOwner->GetPos() + v3Offset;
-        pOwner->SetPos(vNewPosition);
-      }
+      return;
     }
-
-    // Set state
     m_pRigidbody->SetCurrentState(physics::ERigidbodyState::COLLIDING);
   }
   // ------------------------------------
-  void CRigidbodyComponent::OnCollisionExit(const collision::THitEvent&)
+  void CRigidbodyComponent::OnCollisionExit(const collision::THitEvent& _oHitEvent)
   {
-    m_pRigidbody->SetCurrentState(physics::ERigidbodyState::IN_THE_AIR);
-  }
-  // ------------------------------------
-  void CRigidbodyComponent::OnApplyVelocity(const math::CVector3& _v3Velocity)
-  {
-    CEntity* pOwner = GetOwner();
-    if (pOwner)
+    if (_oHitEvent.Trigger)
     {
-      math::CVector3 vNewPosition = pOwner->GetPos() + _v3Velocity;
-      pOwner->SetPos(vNewPosition);
-    }
-  }
-  // ------------------------------------
-  void CRigidbodyComponent::OnApplyRotation(const math::CVector3& _v3Rot)
-  {
-    CEntity* pOwner = GetOwner();
-    if (pOwner)
-    {
-      math::CVector3 vNewRot = pOwner->GetRot() + _v3Rot;
-      pOwner->SetRot(vNewRot);
+      return;
     }
+    m_pRigidbody->SetCurrentState(physics::ERigidbodyState::IN_THE_AIR);
   }
   // ------------------------------------
   void CRigidbodyComponent::Clean()
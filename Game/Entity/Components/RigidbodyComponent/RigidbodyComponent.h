@@ -20,6 +20,9 @@ namespace game
 
     inline const float GetMass() const { return m_pRigidbody->GetMass(); }
     inline void SetMass(float _fMass) { m_pRigidbody->SetMass(_fMass); }
+    // Mass, center of mass and inertia from the collider of the owner (call it again after resizing the collider)
+    void ComputeMassProperties(float _fDensity = physics::s_fDefaultDensity);
+    inline const utils::CWeakPtr<physics::CRigidbody>& GetRigidbody() const { return m_pRigidbody; }
 
   protected:
     virtual void OnCollisionEnter(const collision::THitEvent&) override;
@@ -32,8 +35,6 @@ namespace game
 
   private:
     void Clean();
-    void OnApplyVelocity(const math::CVector3& _v3Velocity);
-    void OnApplyRotation(const math::CVector3& _v3Rot);
 
   private:
     utils::CWeakPtr<physics::CRigidbody> m_pRigidbody;
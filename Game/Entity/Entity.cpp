@@ -73,6 +73,41 @@ namespace game
     }
   }
   // ------------------------------------
+  void CEntity::SetPosRot(const math::CVector3& _v3Pos, const math::CVector3& _v3Rot)
+  {
+    // Set position + rotation
+    m_oTransform.SetPos(_v3Pos);
+    m_oTransform.SetRot(_v3Rot);
+
+    // Notify to components
+    for (uint16_t uI = 0; uI < m_lstComponents.GetSize(); uI++)
+    {
+      m_lstComponents[uI]->OnTransformChanged(_v3Pos, _v3Rot);
+    }
+  }
+  // ------------------------------------
+  void CEntity::SetTransform(const math::CTransform& _oTransform)
+  {
+    m_oTransform = _oTransform;
+
+    // Notify to components
+    const math::CVector3 v3Pos = m_oTransform.GetPos();
+    const math::CVector3 v3Rot = m_oTransform.GetRot();
+    for (uint16_t uI = 0; uI < m_lstComponents.GetSize(); uI++)
+    {
+      m_lstComponents[uI]->OnTransformChanged(v3Pos, v3Rot);
+    }
+  }
+  // ------------------------------------
+  void CEntity::SetRenderPosRot(const math::CVector3& _v3Pos, const math::CVector3& _v3Rot)
+  {
+    // Notify to components
+    for (uint16_t uI = 0; uI < m_lstComponents.GetSize(); uI++)
+    {
+      m_lstComponents[uI]->OnRenderTransformChanged(_v3Pos, _v3Rot);
+    }
+  }
+  // ------------------------------------
   void CEntity::SetScl(const math::CVector3& _v3Scl)
   {
     // Set scale
@@ -38,6 +38,12 @@ namespace game
     inline math::CVector3 GetRot() const { return m_oTransform.GetRot(); }
     void SetScl(const math::CVector3& _v3Scl);
     inline math::CVector3 GetScl() const { return m_oTransform.GetScl(); }
+    // One notification for both (physics sync)
+    void SetPosRot(const math::CVector3& _v3Pos, const math::CVector3& _v3Rot);
+    // Render pose only, the transform is not modified
+    void SetRenderPosRot(const math::CVector3& _v3Pos, const math::CVector3& _v3Rot);
+    // Exact transform (rollback), notified as a new position + rotation
+    void SetTransform(const math::CTransform& _oTransform);
 
     template<typename T, typename ...Args>
     inline T* RegisterComponent(Args&&... _rArgs)
@@ -50,7 +56,7 @@ namespace game
     {
       for (uint16_t uI = 0; uI < m_lstComponents.GetSize(); uI++)
       {
-        T* pComponent = static_cast<T*>(m_lstComponents[uI]);
+        T* pComponent = dynamic_cast<T*>(m_lstComponents[uI]);
         if (pComponent)
         {
           return pComponent;
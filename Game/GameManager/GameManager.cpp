@@ -67,9 +67,109 @@ namespace game
   // ------------------------------------
   void CGameManager::DestroyAll()
   {
+    m_lstInterpolations.clear();
     m_lstEntitiesList.clear();
   }
   // ------------------------------------
+  void CGameManager::ApplyMotions(const physics::CPhysicsManager::TMotionList& _lstMotions)
+  {
+    for (const physics::CPhysicsManager::TMotion& rMotion : _lstMotions)
+    {
+      CEntity* pEntity = static_cast<CEntity*>(rMotion.Owner);
+      if (pEntity)
+      {
+        TInterpolation& rInterpolation = m_lstInterpolations.emplace_back();
+        rInterpolation.Entity = pEntity;
+        rInterpolation.PrevPos = pEntity->GetPos();
+        rInterpolation.PrevRot = pEntity->GetRot();
+        m_bInterpolationsSorted = false;
+
+        pEntity->SetPosRot(pEntity->GetPos() + rMotion.Displacement, pEntity->GetRot() + rMotion.Rotation);
+      }
+    }
+  }
+  // ------------------------------------
+  void CGameManager::BeginFixedTick()
+  {
+    ResetRenderPoses();
+  }
+  // ------------------------------------
+  void CGameManager::InterpolateRender(float _fAlpha)
+  {
+    if (!m_bInterpolationsSorted)
+    {
+      // Substeps move the same entity more than once, keep its first pose of the tick
+      std::stable_sort(m_lstInterpolations.begin(), m_lstInterpolations.end(), [](const TInterpolation& _rA, const TInterpolation& _rB)
+      {
+        return _rA.Entity < _rB.Entity;
+      });
+      m_lstInterpolations.erase(std::unique(m_lstInterpolations.begin(), m_lstInterpolations.end(), [](const TInterpolation& _rA, const TInterpolation& _rB)
+      {
+        return _rA.Entity == _rB.Entity;
+      }), m_lstInterpolations.end());
+      m_bInterpolationsSorted = true;
+    }
+
+    for (const TInterpolation& rInterpolation : m_lstInterpolations)
+    {
+      CEntity* pEntity = rInterpolation.Entity;
+      math::CVector3 v3Pos = rInterpolation.PrevPos + ((pEntity->GetPos() - rInterpolation.PrevPos) * _fAlpha);
+      math::CVector3 v3Rot = rInterpolation.PrevRot + ((pEntity->GetRot() - rInterpolation.PrevRot) * _fAlpha);
+      pEntity->SetRenderPosRot(v3Pos, v3Rot);
+    }
+  }
+  // ------------------------------------
+  void CGameManager::ResetRenderPoses()
+  {
+    // The render state goes back to the simulated one
+    for (const TInterpolation& rInterpolation : m_lstInterpolations)
+    {
+      rInterpolation.Entity->SetRenderPosRot(rInterpolation.Entity->GetPos(), rInterpolation.Entity->GetRot());
+    }
+    m_lstInterpolations.clear();
+    m_bInterpolationsSorted = true;
+  }
+  // ------------------------------------
+  void CGameManager::SaveWorld(TWorldSnapshot& _rSnapshot_) const
+  {
+    physics::CPhysicsManager* pPhysicsManager = physics::CPhysicsManager::GetInstance();
+    collision::CCollisionManager* pCollisionManager = collision::CCollisionManager::GetInstance();
+    pPhysicsManager->SaveSnapshot(_rSnapshot_.Physics);
+    pCollisionManager->SaveSnapshot(_rSnapshot_.Collisions);
+
+    // Owners of the rigidbodys (the motions are applied to them)
+    _rSnapshot_.Poses.clear();
+    for (size_t tIndex = 0; tIndex < pCollisionManager->GetColliderCount(); ++tIndex)
+    {
+      const physics::CRigidbody* pRigidbody = pCollisionManager->GetCollider(tIndex)->GetRigidbody();
+      CEntity* pEntity = pRigidbody ? static_cast<CEntity*>(pRigidbody->GetOwner()) : nullptr;
+      if (pEntity)
+      {
+        _rSnapshot_.Poses.push_back({ pEntity, pEntity->GetTransform() });
+      }
+    }
+  }
+  // ------------------------------------
+  bool CGameManager::RestoreWorld(const TWorldSnapshot& _rSnapshot)
+  {
+    physics::CPhysicsManager* pPhysicsManager = physics::CPhysicsManager::GetInstance();
+    collision::CCollisionManager* pCollisionManager = collision::CCollisionManager::GetInstance();
+    if (!pPhysicsManager->IsSnapshotValid(_rSnapshot.Physics) || !pCollisionManager->IsSnapshotValid(_rSnapshot.Collisions))
+    {
+      return false;
+    }
+
+    // Entities first, their components push the poses to the colliders (overwritten with the exact ones just after)
+    ResetRenderPoses();
+    for (const TWorldSnapshot::TEntityPose& rPose : _rSnapshot.Poses)
+    {
+      rPose.Entity->SetTransform(rPose.Transform);
+    }
+    pCollisionManager->RestoreSnapshot(_rSnapshot.Collisions);
+    pPhysicsManager->RestoreSnapshot(_rSnapshot.Physics);
+    return true;
+  }
+  // ------------------------------------
   CEntity* CGameManager::CreateEntity(const char* _sEntityName)
   {
     if (m_uRegisteredEntities >= m_lstEntitiesList.max_size())
@@ -108,6 +208,8 @@ namespace game
     {
       if (strcmp(it->GetName().c_str(), _sEntityName) == 0)
       {
+        // Entities are moved in memory by the erase
+        ResetRenderPoses();
         m_lstEntitiesList.erase(it);
         return true;
       }
@@ -3,6 +3,7 @@
 #include "Libs/Utils/Singleton.h"
 #include "Engine/Collisions/CollisionManager.h"
 #include "Libs/Utils/UniquePtrList.h"
+#include "Engine/Physics/PhysicsManager.h"
 
 namespace collision { class CCollider; }
 
@@ -14,22 +15,60 @@ namespace game
     static const uint32_t s_uMaxEntities = 10000u;
     typedef std::vector<CEntity> TEntitiesList;
 
+    // Physics rollback: simulation state + poses of the entities moved by the physics
+    struct TWorldSnapshot
+    {
+      struct TEntityPose
+      {
+        CEntity* Entity = nullptr;
+        math::CTransform Transform = math::CTransform();
+      };
+
+      physics::CPhysicsManager::TSnapshot Physics;
+      collision::CCollisionManager::TSnapshot Collisions;
+      std::vector<TEntityPose> Poses;
+    };
+
   public:
     CGameManager() { m_lstEntitiesList.reserve(s_uMaxEntities); };
     ~CGameManager();
 
     void Update(float _fDeltaTime);
+    // Sync pass after the physics step, one transform update per moved entity
+    void ApplyMotions(const physics::CPhysicsManager::TMotionList& _lstMotions);
+
+    // Render interpolation: poses at the beginning of the fixed tick -> current poses
+    void BeginFixedTick();
+    void InterpolateRender(float _fAlpha);
+
+    // Big structure, keep it alive between saves (the buffers are reused). The restore fails (nothing is restored)
+    // if bodies or colliders were created or destroyed since the save
+    void SaveWorld(TWorldSnapshot& _rSnapshot_) const;
+    bool RestoreWorld(const TWorldSnapshot& _rSnapshot);
 
     CEntity* CreateEntity(const char* _sEntityName);
     bool DestroyEntity(const char* _sEntityName);
 
+  private:
+    struct TInterpolation
+    {
+      CEntity* Entity = nullptr;
+      math::CVector3 PrevPos = math::CVector3::Zero;
+      math::CVector3 PrevRot = math::CVector3::Zero;
+    };
+
   private:
     void DestroyAll();
+    void ResetRenderPoses();
 
     TEntitiesList m_lstEntitiesList;
     std::unordered_map<std::string, uint32_t> m_uMapNextSuffix;
     std::unordered_set<std::string> m_uSetNames;
     uint32_t m_uRegisteredEntities = 0;
+
+    // Entities moved by the last fixed tick (one per motion, the first one of each entity is the previous pose)
+    std::vector<TInterpolation> m_lstInterpolations;
+    bool m_bInterpolationsSorted = true;
   };
 }
 
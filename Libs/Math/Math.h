@@ -97,54 +97,46 @@ namespace math
     return fDot > 0.0f;
   }
 
-  inline bool SeparateAxisTheorem
-  (
-    const std::vector<math::CVector3>& _lstPointsA, const std::vector<math::CVector3>& _lstPointsB,
-    const math::CVector3& _v3Axis, math::CVector3& _v3ImpactPoint_, math::CVector3& _v3Normal_, float& _fDepth_
-  )
+  // Projection of a set of points on an axis
+  struct TAxisProjection
   {
-    if (_v3Axis.IsZero())
-    {
-      return false;
-    }
+    float Min = FLT_MAX;
+    float Max = -FLT_MAX;
+    math::CVector3 MinPoint = math::CVector3::Zero; // Point with the min projection
+  };
 
-    // Get A Values
-    float fMinA = FLT_MAX, fMaxA = -FLT_MAX;
-    math::CVector3 v3ClosestPointA = math::CVector3::Zero;
-    for (const math::CVector3& v3Vertex : _lstPointsA)
-    {
-      float fDot = math::CVector3::Dot(v3Vertex, _v3Axis);
-      if (fDot < fMinA)
-      {
-        v3ClosestPointA = v3Vertex;
-      }
-      fMinA = math::Min(fMinA, fDot);
-      fMaxA = math::Max(fMaxA, fDot);
-    }
-
-    // Get B Values
-    float fMinB = FLT_MAX, fMaxB = -FLT_MAX;
-    math::CVector3 v3ClosestPointB = math::CVector3::Zero;
-    for (const math::CVector3& v3Vertex : _lstPointsB)
+  inline math::TAxisProjection ProjectPoints(const math::CVector3* _pPoints, size_t _tPointCount, const math::CVector3& _v3Axis)
+  {
+    math::TAxisProjection oProjection;
+    for (size_t tIndex = 0; tIndex < _tPointCount; ++tIndex)
     {
-      float fDot = math::CVector3::Dot(v3Vertex, _v3Axis);
-      if (fDot < fMinB)
+      float fDot = math::CVector3::Dot(_pPoints[tIndex], _v3Axis);
+      if (fDot < oProjection.Min)
       {
-        v3ClosestPointB = v3Vertex;
+        oProjection.MinPoint = _pPoints[tIndex];
       }
-      fMinB = math::Min(fMinB, fDot);
-      fMaxB = math::Max(fMaxB, fDot);
+      oProjection.Min = math::Min(oProjection.Min, fDot);
+      oProjection.Max = math::Max(oProjection.Max, fDot);
     }
+    return oProjection;
+  }
 
+  // Returns true when the axis separates both projections, otherwise keeps the minimum penetration
+  inline bool SeparateAxisTheorem
+  (
+    const math::TAxisProjection& _oProjectionA, const math::TAxisProjection& _oProjectionB,
+    const math::CVector3& _v3Axis, math::CVector3& _v3ImpactPoint_, math::CVector3& _v3Normal_, float& _fDepth_
+  )
+  {
     // Check separation
-    if (fMinA > fMaxB || fMinB > fMaxA)
+    if (_oProjectionA.Min > _oProjectionB.Max || _oProjectionB.Min > _oProjectionA.Max)
     {
       return true; // No collision
     }
 
     // Compute depth
-    float fOverlapA = fMaxB - fMinA;
-    float fOverlapB = fMaxA - fMinB;
+    float fOverlapA = _oProjectionB.Max - _oProjectionA.Min;
+    float fOverlapB = _oProjectionA.Max - _oProjectionB.Min;
     float fCurrentDepth = math::Min(fOverlapA, fOverlapB);
 
     // Update current depth
@@ -158,12 +150,28 @@ namespace math
 
       // Calculate impact point
       math::CVector3 v3Offset = _v3Normal_ * (_fDepth_ * 0.5f);
-      _v3ImpactPoint_ = (_fDepth_ == fOverlapA) ? v3ClosestPointA + v3Offset : v3ClosestPointB - v3Offset;
+      _v3ImpactPoint_ = (_fDepth_ == fOverlapA) ? _oProjectionA.MinPoint + v3Offset : _oProjectionB.MinPoint - v3Offset;
     }
 
     return false; // Valid
   }
 
+  inline bool SeparateAxisTheorem
+  (
+    const math::CVector3* _pPointsA, size_t _tPointCountA, const math::CVector3* _pPointsB, size_t _tPointCountB,
+    const math::CVector3& _v3Axis, math::CVector3& _v3ImpactPoint_, math::CVector3& _v3Normal_, float& _fDepth_
+  )
+  {
+    if (_v3Axis.IsZero())
+    {
+      return false;
+    }
+
+    math::TAxisProjection oProjectionA = math::ProjectPoints(_pPointsA, _tPointCountA, _v3Axis);
+    math::TAxisProjection oProjectionB = math::ProjectPoints(_pPointsB, _tPointCountB, _v3Axis);
+    return math::SeparateAxisTheorem(oProjectionA, oProjectionB, _v3Axis, _v3ImpactPoint_, _v3Normal_, _fDepth_);
+  }
+
   inline float SqDistPointSegment(math::CVector3 a, math::CVector3 b, math::CVector3 c)
   {
     math::CVector3 ab = b - a;
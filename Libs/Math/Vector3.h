@@ -16,7 +16,6 @@ namespace math
   public:
     CVector3() : x(0.0f), y(0.0f), z(0.0f) {}
     CVector3(float _x, float _y, float _z) : x(_x), y(_y), z(_z) {}
-    ~CVector3() {}
 
     inline CVector3 operator+(const CVector3& _v3) const { return CVector3(x + _v3.x, y + _v3.y, z + _v3.z); }
     inline CVector3 operator-(const CVector3& _v3) const { return CVector3(x - _v3.x, y - _v3.y, z - _v3.z); }
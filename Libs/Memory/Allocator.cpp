@@ -1,220 +1,550 @@
 #include "Allocator.h"
 #include <cstdio>
 #include <cassert>
-#include <cstdlib>
 #include <new>
-#include <iostream>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
 
 namespace mem
 {
-  static const float s_round(0.49999f);
-
-  CAllocator::CAllocator(size_t size) :
-    memory_size(size), alloc_count(0)
+  namespace internal_allocator
   {
-    internal_memory = new uchar[memory_size];
-    memory_free = memory_size;
+    static constexpr size_t s_tFREE_BIT = 1u << 0;
+    static constexpr size_t s_tPREV_FREE_BIT = 1u << 1;
+    static constexpr size_t s_tSIZE_MASK = ~(s_tFREE_BIT | s_tPREV_FREE_BIT);
 
-    allocated_size = memory_size - memory_free;
-    block_count = memory_size / s_uMEM_ALIGNMENT;
+    // The size is the only field of a used block (the previous pointer belongs to the previous block)
+    static constexpr size_t s_tBLOCK_OVERHEAD = sizeof(size_t);
+    static constexpr size_t s_tBLOCK_START_OFFSET = offsetof(header_block, size) + sizeof(size_t);
+    static constexpr size_t s_tBLOCK_SIZE_MIN = ((sizeof(header_block) - sizeof(header_block*)) + (s_uBYTE_ALIGNMENT - 1)) & ~static_cast<size_t>(s_uBYTE_ALIGNMENT - 1);
+    static constexpr size_t s_tBLOCK_SIZE_MAX = static_cast<size_t>(1) << CAllocator::s_uFL_MAX;
+    static constexpr size_t s_tSMALL_BLOCK_SIZE = static_cast<size_t>(1) << CAllocator::s_uFL_SHIFT;
 
-    setup_headers();
-  }
-  // ------------------------------------
-  void CAllocator::setup_headers()
-  {
-    assert(block_count >= 0);
-    for (size_t index = 0; index < memory_size; index++)
+    // Bit scans (value != 0)
+    inline uint32_t find_first_set(uint32_t value)
     {
-      auto* header_block_ptr = reinterpret_cast<mem::header_block*>(internal_memory + index);
-      header_block_ptr->block_size = 0;
+#ifdef _MSC_VER
+      unsigned long index = 0;
+      _BitScanForward(&index, value);
+      return static_cast<uint32_t>(index);
+#else
+      return static_cast<uint32_t>(__builtin_ctz(value));
+#endif
     }
-  }
-  // ------------------------------------
-  void* CAllocator::alloc(size_t size)
-  {
-    assert(size != 0);
-    if (!internal_memory)
+
+    inline uint32_t find_last_set(uint32_t value)
+    {
+#ifdef _MSC_VER
+      unsigned long index = 0;
+      _BitScanReverse(&index, value);
+      return static_cast<uint32_t>(index);
+#else
+      return static_cast<uint32_t>(31 - __builtin_clz(value));
+#endif
+    }
+
+    inline size_t align_up(size_t value, size_t alignment) { return (value + (alignment - 1)) & ~(alignment - 1); }
+    inline size_t align_down(size_t value, size_t alignment) { return value - (value & (alignment - 1)); }
+    inline CAllocator::uchar* align_ptr(CAllocator::uchar* ptr, size_t alignment)
+    {
+      return reinterpret_cast<CAllocator::uchar*>(align_up(reinterpret_cast<uintptr_t>(ptr), alignment));
+    }
+
+    inline size_t get_size(const header_block* block) { return block->size & s_tSIZE_MASK; }
+    inline void set_size(header_block* block, size_t size) { block->size = size | (block->size & ~s_tSIZE_MASK); }
+    inline bool is_last(const header_block* block) { return get_size(block) == 0; }
+
+    inline bool is_free(const header_block* block) { return (block->size & s_tFREE_BIT) != 0; }
+    inline void set_free(header_block* block) { block->size |= s_tFREE_BIT; }
+    inline void set_used(header_block* block) { block->size &= ~s_tFREE_BIT; }
+    inline bool is_prev_free(const header_block* block) { return (block->size & s_tPREV_FREE_BIT) != 0; }
+    inline void set_prev_free(header_block* block) { block->size |= s_tPREV_FREE_BIT; }
+    inline void set_prev_used(header_block* block) { block->size &= ~s_tPREV_FREE_BIT; }
+
+    inline void* to_ptr(const header_block* block)
+    {
+      return const_cast<CAllocator::uchar*>(reinterpret_cast<const CAllocator::uchar*>(block)) + s_tBLOCK_START_OFFSET;
+    }
+    inline header_block* from_ptr(const void* ptr)
+    {
+      return reinterpret_cast<header_block*>(const_cast<CAllocator::uchar*>(static_cast<const CAllocator::uchar*>(ptr)) - s_tBLOCK_START_OFFSET);
+    }
+    inline header_block* offset_to_block(const void* ptr, size_t offset)
+    {
+      return reinterpret_cast<header_block*>(const_cast<CAllocator::uchar*>(static_cast<const CAllocator::uchar*>(ptr)) + offset);
+    }
+
+    // The next header starts in the last bytes of the data (its previous pointer)
+    inline header_block* get_next(const header_block* block) { return offset_to_block(to_ptr(block), get_size(block) - s_tBLOCK_OVERHEAD); }
+    inline header_block* link_next(header_block* block)
     {
-      return std::malloc(size);
+      header_block* next = get_next(block);
+      next->prev_physical = block;
+      return next;
     }
 
-    size_t free_blocks_count = get_free_blocks();
-    bool free_blocks = ((free_blocks_count * s_uMEM_ALIGNMENT) >= size);
-    if (!free_blocks)
+    inline void mark_as_free(header_block* block)
+    {
+      header_block* next = link_next(block);
+      set_prev_free(next);
+      set_free(block);
+    }
+    inline void mark_as_used(header_block* block)
     {
-      printf("Add extra memory!\n");
-      throw std::bad_alloc();
+      header_block* next = get_next(block);
+      set_prev_used(next);
+      set_used(block);
     }
 
-    // get address
-    void* address = get_free_memory_block(size);
+    inline bool can_split(const header_block* block, size_t size) { return get_size(block) >= sizeof(header_block) + size; }
 
-    // update header stats
-    mem::header_block* header_block_ptr = get_free_header_block(size);
-    if (size <= s_uBYTE_ALIGNMENT)
+    // Aligned size >= minimum block size, 0 if the request is too big
+    inline size_t adjust_request_size(size_t size)
     {
-      for (uint32_t index = 0; index < s_uBYTE_ALIGNMENT; index++)
+      if (size == 0 || size >= s_tBLOCK_SIZE_MAX)
       {
-        if (header_block_ptr->get_size(index) == 0)
-        {
-          header_block_ptr->set_size(index, static_cast<uint32_t>(size));
-          break;
-        }
+        return 0;
       }
+      const size_t aligned = align_up(size, s_uBYTE_ALIGNMENT);
+      return aligned < s_tBLOCK_SIZE_MIN ? s_tBLOCK_SIZE_MIN : aligned;
     }
-    else
+
+    // Lists of a size (insert)
+    inline void mapping_insert(size_t size, uint32_t& fl_, uint32_t& sl_)
     {
-      header_block_ptr->block_size = static_cast<uint32_t>(size);
+      if (size < s_tSMALL_BLOCK_SIZE)
+      {
+        // Small blocks are in the first list, linear ranges
+        fl_ = 0;
+        sl_ = static_cast<uint32_t>(size) / static_cast<uint32_t>(s_tSMALL_BLOCK_SIZE / CAllocator::s_uSL_COUNT);
+      }
+      else
+      {
+        const uint32_t last_set = find_last_set(static_cast<uint32_t>(size));
+        sl_ = static_cast<uint32_t>(size >> (last_set - CAllocator::s_uSL_COUNT_LOG2)) ^ CAllocator::s_uSL_COUNT;
+        fl_ = last_set - (CAllocator::s_uFL_SHIFT - 1u);
+      }
     }
 
-    // update values
-    allocated_size += size;
-    memory_free -= size;
-    alloc_count++;
+    // Lists of a size (search): rounds up to the next list, every block of the list is big enough
+    inline void mapping_search(size_t size, uint32_t& fl_, uint32_t& sl_)
+    {
+      if (size >= s_tSMALL_BLOCK_SIZE)
+      {
+        size += (static_cast<size_t>(1) << (find_last_set(static_cast<uint32_t>(size)) - CAllocator::s_uSL_COUNT_LOG2)) - 1;
+      }
+      mapping_insert(size, fl_, sl_);
+    }
+  }
+  // ------------------------------------
+  CAllocator::CAllocator(size_t size) :
+    memory_size(size)
+  {
+    // First block at the start of the memory, the pool is closed by a used block of size 0
+    const size_t pool_overhead = internal_allocator::s_tBLOCK_START_OFFSET + internal_allocator::s_tBLOCK_OVERHEAD;
+    const size_t pool_size = memory_size > pool_overhead ? internal_allocator::align_down(memory_size - pool_overhead, s_uBYTE_ALIGNMENT) : 0;
+    if (pool_size < internal_allocator::s_tBLOCK_SIZE_MIN || pool_size >= internal_allocator::s_tBLOCK_SIZE_MAX)
+    {
+      printf("Invalid allocator size: %zu\n", memory_size);
+#ifdef _DEBUG
+      assert(false);
+#endif
+      return;
+    }
+
+    internal_memory = new uchar[memory_size];
+
+    header_block* block = get_first_block();
+    block->prev_physical = nullptr;
+    block->size = 0;
+    internal_allocator::set_size(block, pool_size);
+    internal_allocator::set_free(block);
+    internal_allocator::set_prev_used(block);
+    block_insert(block);
 
-    return address;
+    header_block* last_block = internal_allocator::link_next(block);
+    last_block->size = 0;
+    internal_allocator::set_used(last_block);
+    internal_allocator::set_prev_free(last_block);
   }
   // ------------------------------------
-  bool CAllocator::free(void* ptr, size_t size)
+  CAllocator::~CAllocator()
   {
-    assert(ptr || size != 0);
-    std::printf("Freeing: size = %zu\n", size);
+    delete[] internal_memory;
+  }
+  // ------------------------------------
+  void* CAllocator::alloc(size_t size, size_t alignment)
+  {
+#ifdef _DEBUG
+    assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+#endif
+    const size_t adjusted_size = internal_allocator::adjust_request_size(size);
+    if (!internal_memory || adjusted_size == 0)
+    {
+      return nullptr;
+    }
 
-    size_t it = 0;
-    while (it != block_count)
+    if (alignment <= s_uBYTE_ALIGNMENT)
     {
+      return prepare_used(locate_free(adjusted_size), adjusted_size);
+    }
 
+    // Over-aligned: room for the alignment and for a free block in the leading gap
+    const size_t gap_minimum = sizeof(header_block);
+    const size_t size_with_gap = internal_allocator::adjust_request_size(adjusted_size + alignment + gap_minimum);
+    if (size_with_gap == 0)
+    {
+      return nullptr;
     }
 
-    /* size_t free_block = -1;
-     for (size_t index = 0; index < count; index++)
-     {
-       const mem::block_info& block = blocks[index];
-       size_t block_size = block.end_offset - block.start_offset;
-       bool equal_size = (block_size == size);
-       void* current_ptr = (internal_memory + block.start_offset);
+    header_block* block = locate_free(size_with_gap);
+    if (!block)
+    {
+      return nullptr;
+    }
 
-       if (equal_size && current_ptr == ptr)
-       {
-         free_block = index;
-         break;
-       }
-     }*/
+    uchar* ptr = static_cast<uchar*>(internal_allocator::to_ptr(block));
+    uchar* aligned = internal_allocator::align_ptr(ptr, alignment);
+    size_t gap = static_cast<size_t>(aligned - ptr);
 
-     // Not found!
-     //assert(free_block != -1);
+    // The gap is too small to be a free block, next alignment
+    if (gap != 0 && gap < gap_minimum)
+    {
+      const size_t gap_remain = gap_minimum - gap;
+      const size_t offset = gap_remain > alignment ? gap_remain : alignment;
+      aligned = internal_allocator::align_ptr(aligned + offset, alignment);
+      gap = static_cast<size_t>(aligned - ptr);
+    }
 
-     // mark as free
-     //mem::block_header& block = blocks[free_block];
-     //block.free = true;
+    if (gap != 0)
+    {
+      block = trim_free_leading(block, gap);
+    }
+    return prepare_used(block, adjusted_size);
+  }
+  // ------------------------------------
+  bool CAllocator::free(void* ptr)
+  {
+    uchar* raw_ptr = static_cast<uchar*>(ptr);
+    if (!raw_ptr || raw_ptr < internal_memory || raw_ptr >= internal_memory + memory_size)
+    {
+      return false;
+    }
+
+    header_block* block = internal_allocator::from_ptr(ptr);
+#ifdef _DEBUG
+    assert(!internal_allocator::is_free(block)); // Double free
+#endif
+    if (internal_allocator::is_free(block))
+    {
+      return false;
+    }
 
-    allocated_size -= size;
-    memory_free += size;
-    alloc_count = (alloc_count - 1) <= 0 ? 0 : alloc_count--;
+    // Stats
+    allocated_size -= internal_allocator::get_size(block);
+    alloc_count--;
 
+    // Merge with the free neighbours
+    internal_allocator::mark_as_free(block);
+    block = merge_prev(block);
+    block = merge_next(block);
+    block_insert(block);
     return true;
   }
   // ------------------------------------
-  const size_t CAllocator::get_free_blocks() const
+  size_t CAllocator::get_block_size(const void* ptr) const
   {
-    float floating_offset = static_cast<float>(memory_free) / static_cast<float>(s_uMEM_ALIGNMENT);
-    return static_cast<size_t>(std::round(floating_offset + s_round));
+    return ptr ? internal_allocator::get_size(internal_allocator::from_ptr(ptr)) : 0;
   }
   // ------------------------------------
-  void CAllocator::print_memory()
+  size_t CAllocator::get_largest_free_block() const
   {
-    assert(block_count >= 0);
-    for (size_t index = 0; index < block_count; index++)
+    if (fl_bitmap == 0)
     {
-      void* memory_block = get_memory_block(index);
-      mem::header_block* header_block = get_header_block(index);
-      uint32_t block_size = header_block->get_packed_size();
-      printf("address: %p, block size: %u, Free: %d\n", memory_block, block_size, block_size < s_uBYTE_ALIGNMENT);
+      return 0;
     }
+
+    // Last non empty list, its blocks are not sorted
+    const uint32_t fl = internal_allocator::find_last_set(fl_bitmap);
+    const uint32_t sl = internal_allocator::find_last_set(sl_bitmap[fl]);
+
+    size_t largest_size = 0;
+    for (const header_block* block = free_lists[fl][sl]; block; block = block->next_free)
+    {
+      const size_t block_size = internal_allocator::get_size(block);
+      largest_size = block_size > largest_size ? block_size : largest_size;
+    }
+    return largest_size;
   }
   // ------------------------------------
-  void* CAllocator::get_memory_block(size_t index)
+  float CAllocator::get_fragmentation() const
   {
-    assert(block_count >= 0);
-    size_t offset = sizeof(mem::header_block);
-    void* memory_block = reinterpret_cast<uchar*>(internal_memory + offset);
-
-    size_t it = 0;
-    while (it != index)
+    if (memory_free == 0)
     {
-      // get header block
-      mem::header_block* header_block_ptr = get_header_block(it);
-      uint32_t current_size = header_block_ptr->get_packed_size();
-
-      bool valid_size = current_size != INVALID_SIZE;
-      bool out_of_bounds = valid_size ? current_size > s_uBYTE_ALIGNMENT : valid_size;
-      uint32_t aligment = out_of_bounds ? current_size : s_uBYTE_ALIGNMENT;
+      return 0.0f;
+    }
+    return 1.0f - (static_cast<float>(get_largest_free_block()) / static_cast<float>(memory_free));
+  }
+  // ------------------------------------
+  void CAllocator::print_memory() const
+  {
+    if (!internal_memory)
+    {
+      return;
+    }
 
-      offset += static_cast<size_t>(aligment) + sizeof(header_block);
-      assert(offset <= memory_size);
-      memory_block = reinterpret_cast<uchar*>(internal_memory + offset);
+    for (const header_block* block = get_first_block(); !internal_allocator::is_last(block); block = internal_allocator::get_next(block))
+    {
+      printf("address: %p, block size: %zu, Free: %d\n", internal_allocator::to_ptr(block), internal_allocator::get_size(block), internal_allocator::is_free(block));
+    }
+    printf("allocated: %zu, free: %zu, high water mark: %zu, allocations: %zu, free blocks: %zu, fragmentation: %.3f\n",
+      allocated_size, memory_free, high_water_mark, alloc_count, block_count, get_fragmentation());
+  }
+  // ------------------------------------
+  bool CAllocator::check_integrity() const
+  {
+    if (!internal_memory)
+    {
+      return true;
+    }
 
-      it++;
+    // Physical blocks: flags match the neighbours and there are no adjacent free blocks
+    size_t used_size = 0, free_size = 0, free_blocks = 0;
+    bool prev_free = false;
+    const header_block* block = get_first_block();
+    for (; !internal_allocator::is_last(block); block = internal_allocator::get_next(block))
+    {
+      const bool free_block = internal_allocator::is_free(block);
+      if (internal_allocator::is_prev_free(block) != prev_free || (free_block && prev_free))
+      {
+        return false;
+      }
+      if (free_block)
+      {
+        free_size += internal_allocator::get_size(block);
+        free_blocks++;
+      }
+      else
+      {
+        used_size += internal_allocator::get_size(block);
+      }
+      prev_free = free_block;
+    }
+    if (internal_allocator::is_prev_free(block) != prev_free || used_size != allocated_size || free_size != memory_free)
+    {
+      return false;
     }
 
-    return memory_block;
+    // Free lists: bitmaps and block sizes
+    size_t listed_blocks = 0;
+    for (uint32_t fl = 0; fl < s_uFL_COUNT; ++fl)
+    {
+      if (((fl_bitmap >> fl) & 1u) != (sl_bitmap[fl] != 0 ? 1u : 0u))
+      {
+        return false;
+      }
+      for (uint32_t sl = 0; sl < s_uSL_COUNT; ++sl)
+      {
+        if (((sl_bitmap[fl] >> sl) & 1u) != (free_lists[fl][sl] ? 1u : 0u))
+        {
+          return false;
+        }
+        for (const header_block* free_block = free_lists[fl][sl]; free_block; free_block = free_block->next_free)
+        {
+          uint32_t block_fl = 0, block_sl = 0;
+          internal_allocator::mapping_insert(internal_allocator::get_size(free_block), block_fl, block_sl);
+          if (!internal_allocator::is_free(free_block) || block_fl != fl || block_sl != sl)
+          {
+            return false;
+          }
+          listed_blocks++;
+        }
+      }
+    }
+    return listed_blocks == free_blocks && free_blocks == block_count;
   }
   // ------------------------------------
-  void* CAllocator::get_free_memory_block(size_t size)
+  header_block* CAllocator::search_suitable_block(uint32_t& fl_, uint32_t& sl_) const
   {
-    mem::header_block* free_header_block_ptr = get_free_header_block(size);
-    assert(free_header_block_ptr);
-
-    uchar* raw_ptr = reinterpret_cast<uchar*>(free_header_block_ptr);
-    size_t offset = sizeof(mem::header_block) + free_header_block_ptr->get_packed_size();
+    // Same first level, same or bigger second level
+    uint32_t sl_map = sl_bitmap[fl_] & (~0u << sl_);
+    if (sl_map == 0)
+    {
+      // Bigger first level
+      const uint32_t fl_map = (fl_ + 1u) < 32u ? fl_bitmap & (~0u << (fl_ + 1u)) : 0u;
+      if (fl_map == 0)
+      {
+        return nullptr;
+      }
+      fl_ = internal_allocator::find_first_set(fl_map);
+      sl_map = sl_bitmap[fl_];
+    }
+    sl_ = internal_allocator::find_first_set(sl_map);
+    return free_lists[fl_][sl_];
+  }
+  // ------------------------------------
+  void CAllocator::insert_free_block(header_block* block, uint32_t fl, uint32_t sl)
+  {
+    header_block* current = free_lists[fl][sl];
+    block->next_free = current;
+    block->prev_free = nullptr;
+    if (current)
+    {
+      current->prev_free = block;
+    }
+    free_lists[fl][sl] = block;
+    fl_bitmap |= (1u << fl);
+    sl_bitmap[fl] |= (1u << sl);
 
-    uchar* free_memory_block = reinterpret_cast<uchar*>(raw_ptr + offset);
-    return free_memory_block;
+    memory_free += internal_allocator::get_size(block);
+    block_count++;
   }
   // ------------------------------------
-  mem::header_block* CAllocator::get_header_block(size_t index)
+  void CAllocator::remove_free_block(header_block* block, uint32_t fl, uint32_t sl)
   {
-    assert(block_count >= 0);
-    mem::header_block* header_block_ptr = reinterpret_cast<mem::header_block*>(internal_memory);
+    header_block* prev = block->prev_free;
+    header_block* next = block->next_free;
+    if (next)
+    {
+      next->prev_free = prev;
+    }
+    if (prev)
+    {
+      prev->next_free = next;
+    }
 
-    size_t it = 0, offset = 0;
-    while (it != index)
+    // Head of the list
+    if (free_lists[fl][sl] == block)
     {
-      uint32_t current_size = header_block_ptr->get_packed_size();
-      bool valid_size = current_size != INVALID_SIZE;
-      bool out_of_bounds = valid_size ? current_size > s_uBYTE_ALIGNMENT : valid_size;
-      uint32_t aligment = out_of_bounds ? current_size : s_uBYTE_ALIGNMENT;
+      free_lists[fl][sl] = next;
+      if (!next)
+      {
+        sl_bitmap[fl] &= ~(1u << sl);
+        if (sl_bitmap[fl] == 0)
+        {
+          fl_bitmap &= ~(1u << fl);
+        }
+      }
+    }
 
-      offset += static_cast<size_t>(aligment) + sizeof(mem::header_block);
-      assert(offset <= memory_size);
-      header_block_ptr = reinterpret_cast<mem::header_block*>(internal_memory + offset);
+    memory_free -= internal_allocator::get_size(block);
+    block_count--;
+  }
+  // ------------------------------------
+  void CAllocator::block_insert(header_block* block)
+  {
+    uint32_t fl = 0, sl = 0;
+    internal_allocator::mapping_insert(internal_allocator::get_size(block), fl, sl);
+    insert_free_block(block, fl, sl);
+  }
+  // ------------------------------------
+  void CAllocator::block_remove(header_block* block)
+  {
+    uint32_t fl = 0, sl = 0;
+    internal_allocator::mapping_insert(internal_allocator::get_size(block), fl, sl);
+    remove_free_block(block, fl, sl);
+  }
+  // ------------------------------------
+  header_block* CAllocator::block_split(header_block* block, size_t size)
+  {
+    // The remaining block starts after the data of the first one
+    header_block* remaining = internal_allocator::offset_to_block(internal_allocator::to_ptr(block), size - internal_allocator::s_tBLOCK_OVERHEAD);
+    const size_t remaining_size = internal_allocator::get_size(block) - (size + internal_allocator::s_tBLOCK_OVERHEAD);
+#ifdef _DEBUG
+    assert(remaining_size >= internal_allocator::s_tBLOCK_SIZE_MIN);
+#endif
 
-      it++;
+    remaining->size = 0;
+    internal_allocator::set_size(remaining, remaining_size);
+    internal_allocator::set_size(block, size);
+    internal_allocator::mark_as_free(remaining);
+    return remaining;
+  }
+  // ------------------------------------
+  header_block* CAllocator::merge_prev(header_block* block)
+  {
+    if (internal_allocator::is_prev_free(block))
+    {
+      header_block* prev = block->prev_physical;
+      block_remove(prev);
+      internal_allocator::set_size(prev, internal_allocator::get_size(prev) + internal_allocator::get_size(block) + internal_allocator::s_tBLOCK_OVERHEAD);
+      internal_allocator::link_next(prev);
+      block = prev;
     }
-
-    return header_block_ptr;
+    return block;
   }
   // ------------------------------------
-  mem::header_block* CAllocator::get_free_header_block(size_t size)
+  header_block* CAllocator::merge_next(header_block* block)
   {
-    assert(block_count >= 0);
-    size_t it = 0;
-    while (it != block_count)
+    header_block* next = internal_allocator::get_next(block);
+    if (internal_allocator::is_free(next))
     {
-      mem::header_block* header_block_ptr = get_header_block(it);
-      assert(header_block_ptr);
+      block_remove(next);
+      internal_allocator::set_size(block, internal_allocator::get_size(block) + internal_allocator::get_size(next) + internal_allocator::s_tBLOCK_OVERHEAD);
+      internal_allocator::link_next(block);
+    }
+    return block;
+  }
+  // ------------------------------------
+  void CAllocator::trim_free(header_block* block, size_t size)
+  {
+    // The block is free (out of the lists), the tail goes back to the lists
+    if (internal_allocator::can_split(block, size))
+    {
+      header_block* remaining = block_split(block, size);
+      internal_allocator::link_next(block);
+      internal_allocator::set_prev_free(remaining);
+      block_insert(remaining);
+    }
+  }
+  // ------------------------------------
+  header_block* CAllocator::trim_free_leading(header_block* block, size_t size)
+  {
+    // The leading gap goes back to the lists, the block starts after it
+    header_block* remaining = block;
+    if (internal_allocator::can_split(block, size))
+    {
+      remaining = block_split(block, size - internal_allocator::s_tBLOCK_OVERHEAD);
+      internal_allocator::set_prev_free(remaining);
+      internal_allocator::link_next(block);
+      block_insert(block);
+    }
+    return remaining;
+  }
+  // ------------------------------------
+  header_block* CAllocator::locate_free(size_t size)
+  {
+    uint32_t fl = 0, sl = 0;
+    internal_allocator::mapping_search(size, fl, sl);
+    if (fl >= s_uFL_COUNT)
+    {
+      return nullptr;
+    }
 
-      uint32_t current_packed_size = header_block_ptr->get_packed_size();
-      uint32_t target_size = static_cast<uint32_t>(current_packed_size + size);
-      bool empty_size = current_packed_size == 0;
-      bool free_block = (target_size <= s_uBYTE_ALIGNMENT) || (empty_size);
-      if (free_block)
-      {
-        return header_block_ptr;
-      }
-      it++;
+    header_block* block = search_suitable_block(fl, sl);
+    if (block)
+    {
+      remove_free_block(block, fl, sl);
+    }
+    return block;
+  }
+  // ------------------------------------
+  void* CAllocator::prepare_used(header_block* block, size_t size)
+  {
+    if (!block)
+    {
+      return nullptr;
     }
-    return nullptr;
+
+    trim_free(block, size);
+    internal_allocator::mark_as_used(block);
+
+    // Stats
+    allocated_size += internal_allocator::get_size(block);
+    high_water_mark = allocated_size > high_water_mark ? allocated_size : high_water_mark;
+    alloc_count++;
+
+    return internal_allocator::to_ptr(block);
   }
 }
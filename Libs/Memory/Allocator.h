@@ -1,88 +1,95 @@
 #pragma once
+#include <cstddef>
 #include <cstdint>
-#include <cstdlib>
 
 namespace mem
 {
-  /*
-    cosas que hacer:
-    1. que funcione todas alocaciones
-    2. reajustar los bloques libres
-    3. para hacer optimizacion cada cierto N alocaciones ordenary tener un indice para saber donde insertar memoria
-  */
-
-#define INVALID_SIZE 0xCDCDCDCD
   static constexpr uint32_t s_uBYTE_ALIGNMENT = 8u;
 
+  // Physical block: the previous block pointer is only valid when the previous block is free (it overlaps its data),
+  // the free list links only exist while the block is free (they overlap the user data)
   struct header_block
   {
-    size_t block_size;
-
-    void set_size(int idx, uint32_t value)
-    {
-      const size_t mask = 0xF;
-      const size_t shift = idx * 4;
-
-      block_size &= ~(mask << shift);
-      block_size |= ((value & mask) << shift);
-    }
-    uint32_t get_size(int idx) const
-    {
-      const size_t mask = 0xF;
-      const size_t shift = idx * 4;
-      return (block_size >> shift) & mask;
-    }
-    uint32_t get_packed_size() const
-    {
-      uint32_t packed_size = 0, index = 0;
-      while (index != s_uBYTE_ALIGNMENT) { packed_size += get_size(index++); }
-      return packed_size;
-    }
-
-    header_block() : block_size(INVALID_SIZE) {}
-    ~header_block() {}
-  };
+    header_block* prev_physical;
+    size_t size; // Data size, the two low bits are the free flags of this block and of the previous one
 
-  static constexpr uint32_t s_uMEM_ALIGNMENT = sizeof(header_block) + s_uBYTE_ALIGNMENT;
+    header_block* next_free;
+    header_block* prev_free;
+  };
 
+  // Two-level segregated fit allocator: the first level splits the free blocks in powers of two and the second level
+  // splits every power of two in s_uSL_COUNT ranges. A free block is found with two bit scans, malloc and free are O(1)
+  // and freed blocks are merged with their free physical neighbours. Not thread safe
   class CAllocator
   {
   public:
     using uchar = unsigned char;
 
+    static constexpr uint32_t s_uSL_COUNT_LOG2 = 4u;
+    static constexpr uint32_t s_uSL_COUNT = 1u << s_uSL_COUNT_LOG2;
+    static constexpr uint32_t s_uFL_SHIFT = s_uSL_COUNT_LOG2 + 3u; // + log2(s_uBYTE_ALIGNMENT)
+    static constexpr uint32_t s_uFL_MAX = 30u; // Blocks under 1 GB
+    static constexpr uint32_t s_uFL_COUNT = s_uFL_MAX - s_uFL_SHIFT + 1u;
+
   public:
     explicit CAllocator(size_t size);
-    ~CAllocator() {}
+    ~CAllocator();
+
+    CAllocator(const CAllocator&) = delete;
+    CAllocator& operator=(const CAllocator&) = delete;
+
+    // nullptr if there is no free block big enough (alignment is a power of two)
+    void* alloc(size_t size, size_t alignment = s_uBYTE_ALIGNMENT);
+    bool free(void* ptr);
+    // Usable size of an allocated block (>= requested size)
+    size_t get_block_size(const void* ptr) const;
+
+    // Stats (block data sizes, headers are not included)
+    size_t get_allocated_size() const { return allocated_size; }
+    size_t get_memory_size() const { return memory_size; }
+    size_t get_memory_free() const { return memory_free; }
+    size_t get_high_water_mark() const { return high_water_mark; }
+    size_t get_alloc_count() const { return alloc_count; }
+    size_t get_free_blocks() const { return block_count; }
+    size_t get_largest_free_block() const;
+    // 0 = all the free memory is one block, close to 1 = many small free blocks
+    float get_fragmentation() const;
+
+    void print_memory() const;
+    // Walks the physical blocks and the free lists (debug)
+    bool check_integrity() const;
 
-    void* alloc(size_t size);
-    bool free(void* ptr, size_t size);
-
-    const size_t get_allocated_size() const { return allocated_size; }
-    const size_t get_memory_size() const { return memory_size; }
-    const size_t get_memory_free() const { return memory_free; }
+  private:
+    header_block* get_first_block() const { return reinterpret_cast<header_block*>(internal_memory); }
 
-    const size_t get_free_blocks() const;
-    void print_memory();
+    header_block* search_suitable_block(uint32_t& fl_, uint32_t& sl_) const;
+    void insert_free_block(header_block* block, uint32_t fl, uint32_t sl);
+    void remove_free_block(header_block* block, uint32_t fl, uint32_t sl);
+    void block_insert(header_block* block);
+    void block_remove(header_block* block);
 
-  private:
-    void setup_headers();
-    void* get_memory_block(size_t index);
-    void* get_free_memory_block(size_t size);
+    header_block* block_split(header_block* block, size_t size);
+    header_block* merge_prev(header_block* block);
+    header_block* merge_next(header_block* block);
+    void trim_free(header_block* block, size_t size);
+    header_block* trim_free_leading(header_block* block, size_t size);
 
-    header_block* get_header_block(size_t index);
-    header_block* get_free_header_block(size_t size);
+    header_block* locate_free(size_t size);
+    void* prepare_used(header_block* block, size_t size);
 
   private:
-    size_t allocated_size;
-    size_t memory_free;
+    size_t allocated_size = 0;
+    size_t memory_free = 0;
+    size_t high_water_mark = 0;
+
+    size_t memory_size = 0;
+    size_t block_count = 0; // Free blocks
+    size_t alloc_count = 0;
 
-    size_t memory_size;
-    size_t block_count;
-    size_t alloc_count;
+    uchar* internal_memory = nullptr;
 
-    uchar* internal_memory;
+    uint32_t fl_bitmap = 0;
+    uint32_t sl_bitmap[s_uFL_COUNT] = {};
+    header_block* free_lists[s_uFL_COUNT][s_uSL_COUNT] = {};
   };
 }
-
-
-
@@ -0,0 +1,195 @@
+#include "FrameAllocator.h"
+#include "Libs/Macros/GlobalMacros.h"
+#include <atomic>
+#include <cassert>
+#include <cstdlib>
+
+namespace mem
+{
+  namespace internal_frame_allocator
+  {
+    struct TOverflowBlock
+    {
+      TOverflowBlock* Next = nullptr;
+    };
+
+    struct TFrameBuffer
+    {
+      unsigned char* Data = nullptr;
+      size_t Offset = 0;
+
+      TOverflowBlock* OverflowBlocks = nullptr;
+      size_t OverflowSize = 0;
+      uint32_t OverflowCount = 0;
+    };
+
+    struct TFrameArena
+    {
+      TFrameBuffer Buffers[2];
+      uint32_t Current = 0;
+      uint32_t Frame = 0;
+
+      size_t BufferSize = CFrameAllocator::s_tDefaultBufferSize;
+      size_t Peak = 0;
+
+      ~TFrameArena();
+    };
+
+    static std::atomic<uint32_t> s_uFrame{ 0u };
+    static std::atomic<uint32_t> s_uTotalOverflowCount{ 0u };
+    thread_local TFrameArena s_oFrameArena;
+
+    inline uintptr_t AlignUp(uintptr_t _uAddress, size_t _tAlignment)
+    {
+      return (_uAddress + (_tAlignment - 1u)) & ~static_cast<uintptr_t>(_tAlignment - 1u);
+    }
+
+    void ReleaseOverflow(TFrameBuffer& _rBuffer)
+    {
+      TOverflowBlock* pBlock = _rBuffer.OverflowBlocks;
+      while (pBlock)
+      {
+        TOverflowBlock* pNext = pBlock->Next;
+        std::free(pBlock);
+        pBlock = pNext;
+      }
+      _rBuffer.OverflowBlocks = nullptr;
+      _rBuffer.OverflowSize = 0;
+      _rBuffer.OverflowCount = 0;
+    }
+
+    TFrameArena::~TFrameArena()
+    {
+      for (TFrameBuffer& rBuffer : Buffers)
+      {
+        ReleaseOverflow(rBuffer);
+        std::free(rBuffer.Data);
+        rBuffer.Data = nullptr;
+      }
+    }
+
+    // First allocation of the thread in a new frame: the other buffer holds data of two frames ago at least
+    void Flip(TFrameArena& _rArena, uint32_t _uFrame)
+    {
+      TFrameBuffer& rPrevBuffer = _rArena.Buffers[_rArena.Current];
+      const size_t tUsed = rPrevBuffer.Offset + rPrevBuffer.OverflowSize;
+      _rArena.Peak = tUsed > _rArena.Peak ? tUsed : _rArena.Peak;
+
+      _rArena.Current = _uFrame & 1u;
+      _rArena.Frame = _uFrame;
+
+      TFrameBuffer& rBuffer = _rArena.Buffers[_rArena.Current];
+      rBuffer.Offset = 0;
+      if (rBuffer.OverflowBlocks)
+      {
+        ReleaseOverflow(rBuffer);
+      }
+    }
+
+    void* AllocOverflow(TFrameArena& _rArena, TFrameBuffer& _rBuffer, size_t _tSize, size_t _tAlignment)
+    {
+      const size_t tHeaderSize = sizeof(TOverflowBlock) + _tAlignment;
+      if (_tSize > static_cast<size_t>(-1) - tHeaderSize)
+      {
+        return nullptr;
+      }
+
+      TOverflowBlock* pBlock = static_cast<TOverflowBlock*>(std::malloc(_tSize + tHeaderSize));
+      if (!pBlock)
+      {
+        return nullptr;
+      }
+      pBlock->Next = _rBuffer.OverflowBlocks;
+      _rBuffer.OverflowBlocks = pBlock;
+
+      // Reported once per buffer and frame
+      if (_rBuffer.OverflowCount == 0)
+      {
+        WARNING_LOG("Frame allocator overflow (buffer of " << _rArena.BufferSize << " bytes, " << _rBuffer.Offset
+          << " used), " << _tSize << " bytes allocated on the heap");
+      }
+      _rBuffer.OverflowSize += _tSize;
+      _rBuffer.OverflowCount++;
+      s_uTotalOverflowCount.fetch_add(1u, std::memory_order_relaxed);
+
+      return reinterpret_cast<void*>(AlignUp(reinterpret_cast<uintptr_t>(pBlock + 1), _tAlignment));
+    }
+  }
+  // ------------------------------------
+  void CFrameAllocator::BeginFrame()
+  {
+    internal_frame_allocator::s_uFrame.fetch_add(1u, std::memory_order_relaxed);
+  }
+  // ------------------------------------
+  uint32_t CFrameAllocator::GetFrame()
+  {
+    return internal_frame_allocator::s_uFrame.load(std::memory_order_relaxed);
+  }
+  // ------------------------------------
+  void* CFrameAllocator::Alloc(size_t _tSize, size_t _tAlignment)
+  {
+    using namespace internal_frame_allocator;
+#ifdef _DEBUG
+    assert(_tAlignment > 0u && (_tAlignment & (_tAlignment - 1u)) == 0u);
+#endif
+
+    TFrameArena& rArena = s_oFrameArena;
+    const uint32_t uFrame = s_uFrame.load(std::memory_order_relaxed);
+    if (rArena.Frame != uFrame)
+    {
+      Flip(rArena, uFrame);
+    }
+
+    TFrameBuffer& rBuffer = rArena.Buffers[rArena.Current];
+    if (!rBuffer.Data)
+    {
+      rBuffer.Data = static_cast<unsigned char*>(std::malloc(rArena.BufferSize));
+      if (!rBuffer.Data)
+      {
+        return AllocOverflow(rArena, rBuffer, _tSize, _tAlignment);
+      }
+    }
+
+    const uintptr_t uBase = reinterpret_cast<uintptr_t>(rBuffer.Data);
+    const uintptr_t uStart = AlignUp(uBase + rBuffer.Offset, _tAlignment);
+    const size_t tOffset = static_cast<size_t>(uStart - uBase);
+    if (tOffset > rArena.BufferSize || _tSize > rArena.BufferSize - tOffset)
+    {
+      return AllocOverflow(rArena, rBuffer, _tSize, _tAlignment);
+    }
+
+    rBuffer.Offset = tOffset + _tSize;
+    return reinterpret_cast<void*>(uStart);
+  }
+  // ------------------------------------
+  void CFrameAllocator::SetBufferSize(size_t _tSize)
+  {
+    internal_frame_allocator::TFrameArena& rArena = internal_frame_allocator::s_oFrameArena;
+#ifdef _DEBUG
+    assert(!rArena.Buffers[0].Data && !rArena.Buffers[1].Data);
+#endif
+    rArena.BufferSize = _tSize;
+  }
+  // ------------------------------------
+  CFrameAllocator::TStats CFrameAllocator::GetStats()
+  {
+    using namespace internal_frame_allocator;
+    const TFrameArena& rArena = s_oFrameArena;
+    const bool bCurrentFrame = rArena.Frame == s_uFrame.load(std::memory_order_relaxed);
+    const TFrameBuffer& rBuffer = rArena.Buffers[rArena.Current];
+
+    TStats oStats = TStats();
+    oStats.Capacity = rArena.BufferSize;
+    oStats.Used = bCurrentFrame ? rBuffer.Offset : 0u;
+    oStats.OverflowSize = bCurrentFrame ? rBuffer.OverflowSize : 0u;
+    oStats.OverflowCount = bCurrentFrame ? rBuffer.OverflowCount : 0u;
+    const size_t tUsed = oStats.Used + oStats.OverflowSize;
+    oStats.Peak = tUsed > rArena.Peak ? tUsed : rArena.Peak;
+    return oStats;
+  }
+  // ------------------------------------
+  uint32_t CFrameAllocator::GetTotalOverflowCount()
+  {
+    return internal_frame_allocator::s_uTotalOverflowCount.load(std::memory_order_relaxed);
+  }
+}
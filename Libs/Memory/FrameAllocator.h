@@ -0,0 +1,83 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <vector>
+
+namespace mem
+{
+  // Per-thread scratch memory for temporary data (query results, vertex lists...). Every thread owns two buffers and
+  // bumps a pointer in the buffer of the current frame, nothing is freed one by one. BeginFrame only advances the frame
+  // counter, each thread flips and resets its other buffer on its next allocation, so the memory of a frame stays valid
+  // until the end of the next one. Allocations that do not fit fall back to the heap and are released with the buffer
+  class CFrameAllocator
+  {
+  public:
+    static constexpr size_t s_tDefaultBufferSize = 1024u * 1024u; // Per buffer and thread
+    static constexpr size_t s_tDefaultAlignment = 16u;
+
+    struct TStats
+    {
+      size_t Used = 0; // Bump allocated bytes of the current buffer (alignment padding included)
+      size_t Capacity = 0;
+      size_t Peak = 0; // Max bytes used by a frame since the thread started (overflow included)
+      size_t OverflowSize = 0; // Heap fallback of the current buffer
+      uint32_t OverflowCount = 0;
+    };
+
+  public:
+    // Called once per frame (CTimeManager::BeginFrame)
+    static void BeginFrame();
+    static uint32_t GetFrame();
+
+    // Valid until the end of the next frame (alignment is a power of two). nullptr if the system is out of memory
+    static void* Alloc(size_t _tSize, size_t _tAlignment = s_tDefaultAlignment);
+    template<typename T>
+    static T* Alloc(size_t _tCount) { return static_cast<T*>(Alloc(_tCount * sizeof(T), alignof(T))); }
+
+    // Buffer size of the calling thread, applied the next time a buffer is created (before the first allocation)
+    static void SetBufferSize(size_t _tSize);
+    // Calling thread
+    static TStats GetStats();
+    // Overflowing allocations of all the threads since the start
+    static uint32_t GetTotalOverflowCount();
+  };
+
+  // STL allocator over the frame buffers: deallocate does nothing, a container must not outlive the next frame.
+  // Reserve the final size when it is known, a reallocation leaves the old storage in the buffer
+  template<typename T>
+  class CFrameStlAllocator
+  {
+  public:
+    typedef T value_type;
+
+  public:
+    CFrameStlAllocator() = default;
+    template<typename U>
+    CFrameStlAllocator(const CFrameStlAllocator<U>&) {}
+
+    T* allocate(size_t _tCount)
+    {
+      if (_tCount > std::numeric_limits<size_t>::max() / sizeof(T))
+      {
+        throw std::bad_array_new_length();
+      }
+      T* pData = CFrameAllocator::Alloc<T>(_tCount);
+      if (!pData)
+      {
+        throw std::bad_alloc();
+      }
+      return pData;
+    }
+    void deallocate(T*, size_t) {}
+
+    template<typename U>
+    bool operator==(const CFrameStlAllocator<U>&) const { return true; }
+    template<typename U>
+    bool operator!=(const CFrameStlAllocator<U>&) const { return false; }
+  };
+
+  template<typename T>
+  using TFrameVector = std::vector<T, CFrameStlAllocator<T>>;
+}
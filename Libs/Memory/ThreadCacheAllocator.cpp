@@ -0,0 +1,267 @@
+#include "ThreadCacheAllocator.h"
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <thread>
+
+namespace mem
+{
+  namespace internal_thread_cache_allocator
+  {
+    struct alignas(16) THeader
+    {
+      uint32_t SizeClass = 0;
+      size_t Size = 0;
+    };
+    static_assert(sizeof(THeader) == CThreadCacheAllocator::s_tHeaderSize, "The header must keep the block alignment");
+
+    struct TFreeBlock
+    {
+      TFreeBlock* Next = nullptr;
+    };
+
+    // Block sizes (header included), multiples of the header size
+    static constexpr uint32_t s_lstClassSizes[] = { 32u, 48u, 64u, 80u, 96u, 112u, 128u, 160u, 192u, 224u, 256u, 320u, 384u, 448u, 512u, 640u, 768u, 896u, 1024u };
+    static constexpr uint32_t s_uClassCount = static_cast<uint32_t>(sizeof(s_lstClassSizes) / sizeof(s_lstClassSizes[0]));
+    static constexpr uint32_t s_uLargeClass = 0xFFFFFFFFu;
+    static_assert(s_lstClassSizes[s_uClassCount - 1] == CThreadCacheAllocator::s_tMaxSmallSize, "The last class must be the max small size");
+
+    static constexpr size_t s_tLookupStep = CThreadCacheAllocator::s_tHeaderSize;
+    typedef std::array<uint8_t, (CThreadCacheAllocator::s_tMaxSmallSize / s_tLookupStep) + 1> TClassLookup;
+
+    constexpr TClassLookup CreateClassLookup()
+    {
+      // Block size / 16 -> smallest class that fits
+      TClassLookup lstLookup = {};
+      uint32_t uClass = 0;
+      for (size_t tIndex = 0; tIndex < lstLookup.size(); ++tIndex)
+      {
+        while (s_lstClassSizes[uClass] < tIndex * s_tLookupStep)
+        {
+          ++uClass;
+        }
+        lstLookup[tIndex] = static_cast<uint8_t>(uClass);
+      }
+      return lstLookup;
+    }
+    static constexpr TClassLookup s_lstClassLookup = CreateClassLookup();
+
+    // Blocks moved between a thread cache and the shared lists at once (~8 KB), a cache keeps up to two batches
+    constexpr uint32_t GetBatchSize(uint32_t _uClass)
+    {
+      const uint32_t uCount = 8192u / s_lstClassSizes[_uClass];
+      return uCount < 4u ? 4u : (uCount > 64u ? 64u : uCount);
+    }
+
+    // Shared lists, constant initialized (operator new can run before the static constructors)
+    struct TCentralList
+    {
+      std::atomic<bool> Locked{ false };
+      TFreeBlock* Head = nullptr;
+
+      void Lock()
+      {
+        while (Locked.exchange(true, std::memory_order_acquire))
+        {
+          std::this_thread::yield();
+        }
+      }
+      void Unlock() { Locked.store(false, std::memory_order_release); }
+    };
+    static TCentralList s_lstCentralLists[s_uClassCount];
+
+    struct TThreadCache
+    {
+      TFreeBlock* Heads[s_uClassCount] = {};
+      uint32_t Counts[s_uClassCount] = {};
+
+      ~TThreadCache();
+    };
+    thread_local TThreadCache s_oThreadCache;
+    thread_local bool s_bThreadCacheDestroyed = false; // Frees after the thread cache destructor go to the shared lists
+
+    TFreeBlock* CreateSlab(uint32_t _uClass)
+    {
+      // Slabs are never released, their blocks are reused by any thread
+      unsigned char* pSlab = static_cast<unsigned char*>(std::malloc(CThreadCacheAllocator::s_tSlabSize));
+      if (!pSlab)
+      {
+        return nullptr;
+      }
+
+      const size_t tBlockSize = s_lstClassSizes[_uClass];
+      const size_t tBlockCount = CThreadCacheAllocator::s_tSlabSize / tBlockSize;
+      for (size_t tIndex = 0; tIndex < tBlockCount; ++tIndex)
+      {
+        TFreeBlock* pBlock = reinterpret_cast<TFreeBlock*>(pSlab + (tIndex * tBlockSize));
+        pBlock->Next = tIndex + 1 < tBlockCount ? reinterpret_cast<TFreeBlock*>(pSlab + ((tIndex + 1) * tBlockSize)) : nullptr;
+      }
+      return reinterpret_cast<TFreeBlock*>(pSlab);
+    }
+
+    // Takes up to _uCount blocks of the shared list (a new slab if it is empty)
+    TFreeBlock* FetchBlocks(uint32_t _uClass, uint32_t _uCount, uint32_t& _uFetched_)
+    {
+      TCentralList& rCentralList = s_lstCentralLists[_uClass];
+      rCentralList.Lock();
+      if (!rCentralList.Head)
+      {
+        rCentralList.Head = CreateSlab(_uClass);
+      }
+
+      TFreeBlock* pFirst = rCentralList.Head;
+      TFreeBlock* pLast = nullptr;
+      _uFetched_ = 0;
+      for (TFreeBlock* pBlock = pFirst; pBlock && _uFetched_ < _uCount; pBlock = pBlock->Next)
+      {
+        pLast = pBlock;
+        ++_uFetched_;
+      }
+      if (pLast)
+      {
+        rCentralList.Head = pLast->Next;
+        pLast->Next = nullptr;
+      }
+      rCentralList.Unlock();
+      return pLast ? pFirst : nullptr;
+    }
+
+    // Chain [_pFirst, _pLast] back to the shared list
+    void ReleaseBlocks(uint32_t _uClass, TFreeBlock* _pFirst, TFreeBlock* _pLast)
+    {
+      TCentralList& rCentralList = s_lstCentralLists[_uClass];
+      rCentralList.Lock();
+      _pLast->Next = rCentralList.Head;
+      rCentralList.Head = _pFirst;
+      rCentralList.Unlock();
+    }
+
+    TThreadCache::~TThreadCache()
+    {
+      for (uint32_t uClass = 0; uClass < s_uClassCount; ++uClass)
+      {
+        TFreeBlock* pLast = Heads[uClass];
+        while (pLast && pLast->Next)
+        {
+          pLast = pLast->Next;
+        }
+        if (pLast)
+        {
+          ReleaseBlocks(uClass, Heads[uClass], pLast);
+        }
+        Heads[uClass] = nullptr;
+        Counts[uClass] = 0;
+      }
+      s_bThreadCacheDestroyed = true;
+    }
+
+    void* PopBlock(uint32_t _uClass)
+    {
+      uint32_t uFetched = 0;
+      if (s_bThreadCacheDestroyed)
+      {
+        return FetchBlocks(_uClass, 1u, uFetched);
+      }
+
+      TThreadCache& rThreadCache = s_oThreadCache;
+      if (!rThreadCache.Heads[_uClass])
+      {
+        rThreadCache.Heads[_uClass] = FetchBlocks(_uClass, GetBatchSize(_uClass), uFetched);
+        rThreadCache.Counts[_uClass] = uFetched;
+        if (!rThreadCache.Heads[_uClass])
+        {
+          return nullptr;
+        }
+      }
+
+      TFreeBlock* pBlock = rThreadCache.Heads[_uClass];
+      rThreadCache.Heads[_uClass] = pBlock->Next;
+      rThreadCache.Counts[_uClass]--;
+      return pBlock;
+    }
+
+    void PushBlock(uint32_t _uClass, void* _pBlock)
+    {
+      TFreeBlock* pBlock = static_cast<TFreeBlock*>(_pBlock);
+      if (s_bThreadCacheDestroyed)
+      {
+        ReleaseBlocks(_uClass, pBlock, pBlock);
+        return;
+      }
+
+      TThreadCache& rThreadCache = s_oThreadCache;
+      pBlock->Next = rThreadCache.Heads[_uClass];
+      rThreadCache.Heads[_uClass] = pBlock;
+      rThreadCache.Counts[_uClass]++;
+
+      // Too many cached blocks: a batch goes back to the shared list (blocks freed by other threads end there too)
+      const uint32_t uBatchSize = GetBatchSize(_uClass);
+      if (rThreadCache.Counts[_uClass] > uBatchSize * 2u)
+      {
+        TFreeBlock* pFirst = rThreadCache.Heads[_uClass];
+        TFreeBlock* pLast = pFirst;
+        for (uint32_t uIndex = 1; uIndex < uBatchSize; ++uIndex)
+        {
+          pLast = pLast->Next;
+        }
+        rThreadCache.Heads[_uClass] = pLast->Next;
+        rThreadCache.Counts[_uClass] -= uBatchSize;
+        ReleaseBlocks(_uClass, pFirst, pLast);
+      }
+    }
+  }
+  // ------------------------------------
+  void* CThreadCacheAllocator::Alloc(size_t _tSize)
+  {
+    using namespace internal_thread_cache_allocator;
+    if (_tSize > static_cast<size_t>(-1) - (s_tHeaderSize * 2u))
+    {
+      return nullptr;
+    }
+
+    const size_t tBlockSize = (_tSize + (s_tHeaderSize * 2u) - 1u) & ~(s_tHeaderSize - 1u);
+    THeader* pHeader = nullptr;
+    uint32_t uSizeClass = s_uLargeClass;
+    if (tBlockSize <= s_tMaxSmallSize)
+    {
+      uSizeClass = s_lstClassLookup[tBlockSize / s_tLookupStep];
+      pHeader = static_cast<THeader*>(PopBlock(uSizeClass));
+    }
+    else
+    {
+      pHeader = static_cast<THeader*>(std::malloc(tBlockSize));
+    }
+
+    if (!pHeader)
+    {
+      return nullptr;
+    }
+    pHeader->SizeClass = uSizeClass;
+    pHeader->Size = _tSize;
+    return pHeader + 1;
+  }
+  // ------------------------------------
+  void CThreadCacheAllocator::Free(void* _pPtr)
+  {
+    using namespace internal_thread_cache_allocator;
+    if (!_pPtr)
+    {
+      return;
+    }
+
+    THeader* pHeader = static_cast<THeader*>(_pPtr) - 1;
+    if (pHeader->SizeClass == s_uLargeClass)
+    {
+      std::free(pHeader);
+    }
+    else
+    {
+      PushBlock(pHeader->SizeClass, pHeader);
+    }
+  }
+  // ------------------------------------
+  size_t CThreadCacheAllocator::GetSize(const void* _pPtr)
+  {
+    return _pPtr ? (static_cast<const internal_thread_cache_allocator::THeader*>(_pPtr) - 1)->Size : 0;
+  }
+}
@@ -0,0 +1,24 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace mem
+{
+  // Backend of the global operator new. Small blocks come from size class slabs through a per-thread cache
+  // (the shared lists are only locked to move batches of blocks), big blocks go to the system allocator.
+  // Every block starts with a header (size class + requested size), blocks are freed without their size
+  class CThreadCacheAllocator
+  {
+  public:
+    static constexpr size_t s_tHeaderSize = 16u; // Keeps the 16 bytes alignment of malloc
+    static constexpr size_t s_tMaxSmallSize = 1024u; // Block size (header included)
+    static constexpr size_t s_tSlabSize = 64u * 1024u;
+
+  public:
+    // nullptr if the system is out of memory
+    static void* Alloc(size_t _tSize);
+    static void Free(void* _pPtr);
+    // Requested size of a block
+    static size_t GetSize(const void* _pPtr);
+  };
+}
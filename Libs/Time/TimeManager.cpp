@@ -1,4 +1,7 @@
 #include "TimeManager.h"
+#include "Libs/Math/Math.h"
+#include "Libs/Memory/FrameAllocator.h"
+#include <cmath>
 
 namespace chrono
 {
@@ -24,6 +27,19 @@ namespace chrono
     m_oBeginFrame = std::chrono::steady_clock::now();
     m_fDeltaTime = std::chrono::duration<float>(m_oBeginFrame - m_oEndFrame).count();
     m_oEndFrame = m_oBeginFrame;
+
+    // Frame scratch memory of two frames ago is reused
+    mem::CFrameAllocator::BeginFrame();
+
+    // Fixed ticks
+    m_fFixedDeltaAcc += math::Clamp(m_fDeltaTime, 0.0f, GetMaxFixedDelta());
+    m_uFixedTicks = math::Min(static_cast<uint32_t>(m_fFixedDeltaAcc / m_fFixedDelta), m_uMaxFixedTicks);
+    m_fFixedDeltaAcc -= static_cast<float>(m_uFixedTicks) * m_fFixedDelta;
+    if (m_fFixedDeltaAcc >= m_fFixedDelta)
+    {
+      // Over budget, the remaining ticks are dropped
+      m_fFixedDeltaAcc = std::fmod(m_fFixedDeltaAcc, m_fFixedDelta);
+    }
   }
   // ------------------------------------
   void CTimeManager::EndFrame()
@@ -43,11 +59,16 @@ namespace chrono
     __int64 i64CountsPerSec = 0;
     QueryPerformanceFrequency(reinterpret_cast<LARGE_INTEGER*>(&i64CountsPerSec));
     m_llTargetTick = (i64CountsPerSec / _iTargetFramerate);
-
-    m_fFixedDelta = static_cast<float>(1.0f / _iTargetFramerate);
     m_iTargetFramerate = _iTargetFramerate;
   }
   // ------------------------------------
+  void CTimeManager::SetFixedFramerate(int32_t _iFramerate)
+  {
+    m_fFixedDelta = static_cast<float>(1.0f / _iFramerate);
+    m_iFixedFramerate = _iFramerate;
+    m_fFixedDeltaAcc = 0.0f;
+  }
+  // ------------------------------------
   float CTimeManager::GetMaxFixedDelta() const
   {
     return internal_time_manager::s_fMaxFixedDelta;
@@ -11,21 +11,44 @@ namespace chrono
     CTimeManager(int32_t _iTargetFramerate = 60);
     ~CTimeManager() {}
 
+    // Accumulates the frame time and computes the fixed ticks of the frame
     void BeginFrame();
     void EndFrame();
 
     inline int32_t GetTargetFramerate() const { return m_iTargetFramerate; }
     void SetTargetFramerate(int32_t _iFramerate);
 
+    // Fixed step (independent from the render framerate)
+    inline int32_t GetFixedFramerate() const { return m_iFixedFramerate; }
+    void SetFixedFramerate(int32_t _iFramerate);
+    // Simulation steps per fixed tick
+    inline void SetSubsteps(uint32_t _uSubsteps) { m_uSubsteps = _uSubsteps > 0u ? _uSubsteps : 1u; }
+    inline const uint32_t& GetSubsteps() const { return m_uSubsteps; }
+    // Max fixed ticks per frame, the time over the budget is dropped (no catch-up spiral)
+    inline void SetMaxFixedTicks(uint32_t _uMaxTicks) { m_uMaxFixedTicks = _uMaxTicks > 0u ? _uMaxTicks : 1u; }
+    inline const uint32_t& GetMaxFixedTicks() const { return m_uMaxFixedTicks; }
+
     inline float GetDeltaTime() const { return m_fDeltaTime; }
     inline float GetFixedDelta() const { return m_fFixedDelta; }
+    inline float GetSubstepDelta() const { return m_fFixedDelta / static_cast<float>(m_uSubsteps); }
     float GetMaxFixedDelta() const;
 
+    // Fixed ticks to run this frame
+    inline const uint32_t& GetFixedTicks() const { return m_uFixedTicks; }
+    // [0, 1) between the last two fixed ticks, used to interpolate the render state
+    inline float GetInterpolationAlpha() const { return m_fFixedDeltaAcc / m_fFixedDelta; }
+
   private:
     int32_t m_iTargetFramerate = 60;
+    int32_t m_iFixedFramerate = 60;
     float m_fFixedDelta = 1.0f / 60.0f;
     float m_fDeltaTime = 0.0f;
 
+    float m_fFixedDeltaAcc = 0.0f;
+    uint32_t m_uFixedTicks = 0;
+    uint32_t m_uSubsteps = 1;
+    uint32_t m_uMaxFixedTicks = 4;
+
   private:
     __int64 m_llBaseTime;
     __int64 m_llPausedTime;
@@ -0,0 +1,303 @@
+#pragma once
+#include <array>
+#include <bitset>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+#include "WeakPtr.h"
+
+namespace utils
+{
+  // Same interface as CFixedPool without a capacity: slots are allocated in chunks of CHUNK_SIZE items when the pool is full.
+  // Chunks are never moved or released until the pool is destroyed, items (and their generations) keep their address.
+  // The iterator walks the chunks in memory order, operator[] uses the dense order (swap removal)
+  template<typename T, size_t CHUNK_SIZE = 64u>
+  class CChunkedPool
+  {
+  private:
+    static_assert(CHUNK_SIZE > 0, "CHUNK_SIZE must be greater than zero");
+    static constexpr size_t s_tInvalidSlot = static_cast<size_t>(-1);
+
+    struct TSlotData
+    {
+      size_t tDenseIndex = 0;
+      size_t tGeneration = 0;
+    };
+
+    // Data first: the address of an item is the address of its internal data (GetSlotIdx)
+    struct TInternalData
+    {
+      alignas(alignof(T)) unsigned char Data[sizeof(T)];
+      size_t SlotIdx = 0; // Own slot while the item is alive, next free slot while the slot is free
+
+      inline T* Get() { return reinterpret_cast<T*>(Data); }
+      inline const T* Get() const { return reinterpret_cast<const T*>(Data); }
+    };
+
+    struct TChunk
+    {
+      std::array<TInternalData, CHUNK_SIZE> InternalData;
+      std::array<TSlotData, CHUNK_SIZE> SparseSlots;
+      std::bitset<CHUNK_SIZE> SlotStates;
+      size_t RegisteredItems = 0;
+    };
+
+  public:
+    CChunkedPool() = default;
+    ~CChunkedPool() { Clear(); }
+
+    CChunkedPool(const CChunkedPool&) = delete;
+    CChunkedPool& operator=(const CChunkedPool&) = delete;
+
+    template<typename _Type = T, typename ...Args>
+    inline CWeakPtr<_Type> Create(Args&&... args)
+    {
+      static_assert(std::is_base_of_v<T, _Type>, "_Type must inherit from or be of type T");
+      if (m_tFirstFreeSlot == s_tInvalidSlot)
+      {
+        AddChunk();
+      }
+
+      // Pop a free slot
+      size_t tSlotIdx = m_tFirstFreeSlot;
+      TChunk& rChunk = GetChunk(tSlotIdx);
+      TInternalData& rInternalData = rChunk.InternalData[tSlotIdx % CHUNK_SIZE];
+      TSlotData& rSlot = rChunk.SparseSlots[tSlotIdx % CHUNK_SIZE];
+      m_tFirstFreeSlot = rInternalData.SlotIdx;
+
+      new (rInternalData.Data) _Type(std::forward<Args>(args)...);
+      rInternalData.SlotIdx = tSlotIdx;
+
+      rSlot.tDenseIndex = m_lstDenseOrder.size();
+      m_lstDenseOrder.emplace_back(tSlotIdx);
+
+      rSlot.tGeneration++;
+      rChunk.SlotStates[tSlotIdx % CHUNK_SIZE] = true;
+      rChunk.RegisteredItems++;
+
+      _Type* pRawPtr = static_cast<_Type*>(rInternalData.Get());
+      return CWeakPtr<_Type>(pRawPtr, &rSlot.tGeneration, rSlot.tGeneration);
+    }
+
+    inline CWeakPtr<T> operator[](size_t _tIndex)
+    {
+      if (_tIndex >= m_lstDenseOrder.size())
+      {
+        return CWeakPtr<T>();
+      }
+      size_t tSlotIdx = m_lstDenseOrder[_tIndex];
+      TChunk& rChunk = GetChunk(tSlotIdx);
+      TSlotData& rSlot = rChunk.SparseSlots[tSlotIdx % CHUNK_SIZE];
+      return CWeakPtr<T>(rChunk.InternalData[tSlotIdx % CHUNK_SIZE].Get(), &rSlot.tGeneration, rSlot.tGeneration);
+    }
+
+    inline const CWeakPtr<T> operator[](size_t _tIndex) const
+    {
+      if (_tIndex >= m_lstDenseOrder.size())
+      {
+        return CWeakPtr<T>();
+      }
+      size_t tSlotIdx = m_lstDenseOrder[_tIndex];
+      const TChunk& rChunk = GetChunk(tSlotIdx);
+      const TSlotData& rSlot = rChunk.SparseSlots[tSlotIdx % CHUNK_SIZE];
+      return CWeakPtr<T>(const_cast<T*>(rChunk.InternalData[tSlotIdx % CHUNK_SIZE].Get()), const_cast<size_t*>(&rSlot.tGeneration), rSlot.tGeneration);
+    }
+
+    // Chunk by chunk, free slots and empty chunks are skipped
+    class CIterator
+    {
+    public:
+      CIterator(CChunkedPool* _pList, size_t _tSlotIdx) : m_pList(_pList), m_tSlotIdx(_tSlotIdx) { SkipFreeSlots(); }
+
+      inline T* operator*() { return m_pList->GetChunk(m_tSlotIdx).InternalData[m_tSlotIdx % CHUNK_SIZE].Get(); }
+      inline T* operator->() { return m_pList->GetChunk(m_tSlotIdx).InternalData[m_tSlotIdx % CHUNK_SIZE].Get(); }
+
+      inline CIterator& operator++() { ++m_tSlotIdx; SkipFreeSlots(); return *this; }
+      inline bool operator!=(const CIterator& _rOther) const { return m_tSlotIdx != _rOther.m_tSlotIdx; }
+
+    private:
+      void SkipFreeSlots()
+      {
+        const size_t tCapacity = m_pList->GetCapacity();
+        while (m_tSlotIdx < tCapacity)
+        {
+          const TChunk& rChunk = m_pList->GetChunk(m_tSlotIdx);
+          if (rChunk.RegisteredItems == 0)
+          {
+            m_tSlotIdx = ((m_tSlotIdx / CHUNK_SIZE) + 1) * CHUNK_SIZE;
+            continue;
+          }
+          if (rChunk.SlotStates[m_tSlotIdx % CHUNK_SIZE])
+          {
+            return;
+          }
+          ++m_tSlotIdx;
+        }
+        m_tSlotIdx = tCapacity;
+      }
+
+    private:
+      CChunkedPool* m_pList;
+      size_t m_tSlotIdx;
+    };
+
+    inline CIterator begin() { return CIterator(this, 0); }
+    inline CIterator end() { return CIterator(this, GetCapacity()); }
+
+    size_t FindIndex(const CWeakPtr<T>& _pItem);
+    bool RemoveAt(size_t _tIndex);
+
+    bool Remove(const CWeakPtr<T>& _pItem);
+    bool Remove(T*& _pItem_);
+    void Clear();
+
+    inline size_t GetSize() const { return m_lstDenseOrder.size(); }
+    inline bool IsEmpty() const { return m_lstDenseOrder.empty(); }
+    inline size_t GetCapacity() const { return m_lstChunks.size() * CHUNK_SIZE; }
+    inline size_t GetChunkCount() const { return m_lstChunks.size(); }
+
+  private:
+    inline TChunk& GetChunk(size_t _tSlotIdx) { return *m_lstChunks[_tSlotIdx / CHUNK_SIZE]; }
+    inline const TChunk& GetChunk(size_t _tSlotIdx) const { return *m_lstChunks[_tSlotIdx / CHUNK_SIZE]; }
+
+    void AddChunk()
+    {
+      // The new slots are pushed in order (first items of the chunk are created in order)
+      const size_t tFirstSlot = GetCapacity();
+      TChunk& rChunk = *m_lstChunks.emplace_back(std::make_unique<TChunk>());
+      for (size_t tIndex = 0; tIndex < CHUNK_SIZE; ++tIndex)
+      {
+        rChunk.InternalData[tIndex].SlotIdx = tIndex + 1 < CHUNK_SIZE ? tFirstSlot + tIndex + 1 : m_tFirstFreeSlot;
+      }
+      m_tFirstFreeSlot = tFirstSlot;
+    }
+
+    size_t GetSlotIdx(const T* _pItem) const
+    {
+      // The internal data of the item keeps its slot, no chunk search. Free slots and items of another pool fail the
+      // address check
+      if (!_pItem)
+      {
+        return s_tInvalidSlot;
+      }
+      const TInternalData* pInternalData = reinterpret_cast<const TInternalData*>(_pItem);
+      const size_t tSlotIdx = pInternalData->SlotIdx;
+      if (tSlotIdx >= GetCapacity())
+      {
+        return s_tInvalidSlot;
+      }
+
+      const TChunk& rChunk = GetChunk(tSlotIdx);
+      const bool bSameSlot = &rChunk.InternalData[tSlotIdx % CHUNK_SIZE] == pInternalData;
+      return bSameSlot && rChunk.SlotStates[tSlotIdx % CHUNK_SIZE] ? tSlotIdx : s_tInvalidSlot;
+    }
+
+  private:
+    std::vector<std::unique_ptr<TChunk>> m_lstChunks;
+    std::vector<size_t> m_lstDenseOrder;
+    size_t m_tFirstFreeSlot = s_tInvalidSlot;
+  };
+
+  template<typename T, size_t CHUNK_SIZE>
+  size_t CChunkedPool<T, CHUNK_SIZE>::FindIndex(const CWeakPtr<T>& _pItem)
+  {
+    if (!_pItem.IsValid())
+    {
+      return static_cast<size_t>(-1);
+    }
+
+    size_t tSlotIdx = GetSlotIdx(_pItem.GetPtr());
+    if (tSlotIdx == s_tInvalidSlot)
+    {
+      return static_cast<size_t>(-1);
+    }
+
+    return GetChunk(tSlotIdx).SparseSlots[tSlotIdx % CHUNK_SIZE].tDenseIndex;
+  }
+
+  template<typename T, size_t CHUNK_SIZE>
+  bool CChunkedPool<T, CHUNK_SIZE>::Remove(const CWeakPtr<T>& _pItem)
+  {
+    size_t tIndex = FindIndex(_pItem);
+    if (tIndex != static_cast<size_t>(-1))
+    {
+      return RemoveAt(tIndex);
+    }
+    return false;
+  }
+
+  template<typename T, size_t CHUNK_SIZE>
+  bool CChunkedPool<T, CHUNK_SIZE>::Remove(T*& _pItem_)
+  {
+    size_t tSlotIdx = GetSlotIdx(_pItem_);
+    if (tSlotIdx != s_tInvalidSlot && RemoveAt(GetChunk(tSlotIdx).SparseSlots[tSlotIdx % CHUNK_SIZE].tDenseIndex))
+    {
+      _pItem_ = nullptr;
+      return true;
+    }
+    return false;
+  }
+
+  template<typename T, size_t CHUNK_SIZE>
+  bool CChunkedPool<T, CHUNK_SIZE>::RemoveAt(size_t _tIndex)
+  {
+    if (_tIndex >= m_lstDenseOrder.size())
+    {
+      return false;
+    }
+
+    size_t tSlotIdxToDelete = m_lstDenseOrder[_tIndex];
+    TChunk& rChunk = GetChunk(tSlotIdxToDelete);
+    TInternalData& rInternalData = rChunk.InternalData[tSlotIdxToDelete % CHUNK_SIZE];
+
+    rInternalData.Get()->~T();
+    rChunk.SlotStates[tSlotIdxToDelete % CHUNK_SIZE] = false;
+    rChunk.SparseSlots[tSlotIdxToDelete % CHUNK_SIZE].tGeneration++;
+    rChunk.RegisteredItems--;
+
+    // Push the slot to the free list
+    rInternalData.SlotIdx = m_tFirstFreeSlot;
+    m_tFirstFreeSlot = tSlotIdxToDelete;
+
+    // Swap removal (the last item takes the dense index)
+    size_t tMovedSlotIdx = m_lstDenseOrder.back();
+    m_lstDenseOrder[_tIndex] = tMovedSlotIdx;
+    m_lstDenseOrder.pop_back();
+    if (tMovedSlotIdx != tSlotIdxToDelete)
+    {
+      GetChunk(tMovedSlotIdx).SparseSlots[tMovedSlotIdx % CHUNK_SIZE].tDenseIndex = _tIndex;
+    }
+    return true;
+  }
+
+  template<typename T, size_t CHUNK_SIZE>
+  void CChunkedPool<T, CHUNK_SIZE>::Clear()
+  {
+    for (size_t tSlotIdx : m_lstDenseOrder)
+    {
+      TChunk& rChunk = GetChunk(tSlotIdx);
+      rChunk.InternalData[tSlotIdx % CHUNK_SIZE].Get()->~T();
+      rChunk.SparseSlots[tSlotIdx % CHUNK_SIZE].tGeneration++;
+    }
+    m_lstDenseOrder.clear();
+
+    // Chunks are kept (generations of the weak pointers), the free list is rebuilt in slot order
+    m_tFirstFreeSlot = s_tInvalidSlot;
+    for (size_t tChunkIdx = m_lstChunks.size(); tChunkIdx-- > 0;)
+    {
+      TChunk& rChunk = *m_lstChunks[tChunkIdx];
+      rChunk.SlotStates.reset();
+      rChunk.RegisteredItems = 0;
+
+      const size_t tFirstSlot = tChunkIdx * CHUNK_SIZE;
+      for (size_t tIndex = 0; tIndex < CHUNK_SIZE; ++tIndex)
+      {
+        rChunk.InternalData[tIndex].SlotIdx = tIndex + 1 < CHUNK_SIZE ? tFirstSlot + tIndex + 1 : m_tFirstFreeSlot;
+      }
+      m_tFirstFreeSlot = tFirstSlot;
+    }
+  }
+}
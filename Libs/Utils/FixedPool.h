@@ -10,10 +10,14 @@
 
 namespace utils
 {
+  // Slots are taken from an intrusive free list and the dense order uses swap removal, create and remove are O(1).
+  // Removing an item moves the last item to its dense index (the dense order is not the creation order)
   template<typename T, size_t MAX_ITEMS>
   class CFixedPool
   {
   private:
+    static constexpr size_t s_tInvalidSlot = static_cast<size_t>(-1);
+
     struct TSlotData
     {
       size_t tDenseIndex = 0;
@@ -23,7 +27,7 @@ namespace utils
     struct TInternalData
     {
       alignas(alignof(T)) unsigned char Data[sizeof(T)];
-      size_t SlotIdx = 0;
+      size_t SlotIdx = 0; // Next free slot while the slot is free
 
       inline T* Get() { return reinterpret_cast<T*>(Data); }
       inline const T* Get() const { return reinterpret_cast<const T*>(Data); }
@@ -45,30 +49,25 @@ namespace utils
         return CWeakPtr<_Type>();
       }
 
-      for (size_t tSlotIdx = 0; tSlotIdx < MAX_ITEMS; ++tSlotIdx)
-      {
-        if (!m_lstSlotStates[tSlotIdx])
-        {
-          TInternalData& rInternalData = m_lstInternalData[tSlotIdx];
-          TSlotData& rSlot = m_lstSparseSlots[tSlotIdx];
-
-          new (rInternalData.Data) _Type(std::forward<Args>(args)...);
-          rInternalData.SlotIdx = tSlotIdx;
+      // Pop a free slot
+      size_t tSlotIdx = m_tFirstFreeSlot;
+      TInternalData& rInternalData = m_lstInternalData[tSlotIdx];
+      TSlotData& rSlot = m_lstSparseSlots[tSlotIdx];
+      m_tFirstFreeSlot = rInternalData.SlotIdx;
 
-          size_t tNewDenseIdx = m_tRegisteredItems;
-          m_lstDenseOrder[tNewDenseIdx] = tSlotIdx;
+      new (rInternalData.Data) _Type(std::forward<Args>(args)...);
+      rInternalData.SlotIdx = tSlotIdx;
 
-          rSlot.tDenseIndex = tNewDenseIdx;
-          rSlot.tGeneration++;
-          m_lstSlotStates[tSlotIdx] = true;
+      size_t tNewDenseIdx = m_tRegisteredItems;
+      m_lstDenseOrder[tNewDenseIdx] = tSlotIdx;
 
-          m_tRegisteredItems++;
-          _Type* pRawPtr = static_cast<_Type*>(rInternalData.Get());
-          return CWeakPtr<_Type>(pRawPtr, &rSlot.tGeneration, rSlot.tGeneration);
-        }
-      }
+      rSlot.tDenseIndex = tNewDenseIdx;
+      rSlot.tGeneration++;
+      m_lstSlotStates[tSlotIdx] = true;
 
-      return CWeakPtr<_Type>();
+      m_tRegisteredItems++;
+      _Type* pRawPtr = static_cast<_Type*>(rInternalData.Get());
+      return CWeakPtr<_Type>(pRawPtr, &rSlot.tGeneration, rSlot.tGeneration);
     }
 
     inline CWeakPtr<T> operator[](size_t _tIndex)
@@ -131,9 +130,30 @@ namespace utils
   private:
     void Init()
     {
+      // Free list in slot order (first items are created in order)
+      for (size_t tSlotIdx = 0; tSlotIdx < MAX_ITEMS; ++tSlotIdx)
+      {
+        m_lstInternalData[tSlotIdx].SlotIdx = tSlotIdx + 1 < MAX_ITEMS ? tSlotIdx + 1 : s_tInvalidSlot;
+      }
+      m_tFirstFreeSlot = MAX_ITEMS > 0 ? 0 : s_tInvalidSlot;
       m_lstSlotStates.reset();
     }
 
+    size_t GetSlotIdx(const T* _pItem) const
+    {
+      const char* pBlock = reinterpret_cast<const char*>(_pItem);
+      const char* pBeginBlock = reinterpret_cast<const char*>(&m_lstInternalData[0]);
+
+      ptrdiff_t tDiff = pBlock - pBeginBlock;
+      if (tDiff < 0 || tDiff >= static_cast<ptrdiff_t>(MAX_ITEMS * sizeof(TInternalData)))
+      {
+        return s_tInvalidSlot;
+      }
+
+      size_t tSlotIdx = static_cast<size_t>(tDiff) / sizeof(TInternalData);
+      return m_lstSlotStates[tSlotIdx] ? tSlotIdx : s_tInvalidSlot;
+    }
+
   private:
     std::array<TInternalData, MAX_ITEMS> m_lstInternalData = std::array<TInternalData, MAX_ITEMS>();
     std::array<TSlotData, MAX_ITEMS> m_lstSparseSlots = std::array<TSlotData, MAX_ITEMS>();
@@ -141,26 +161,14 @@ namespace utils
 
     std::bitset<MAX_ITEMS> m_lstSlotStates;
     size_t m_tRegisteredItems = 0;
+    size_t m_tFirstFreeSlot = s_tInvalidSlot;
   };
 
   template<typename T, size_t MAX_ITEMS>
   bool CFixedPool<T, MAX_ITEMS>::Remove(T*& _pItem_)
   {
-    size_t tIndex = FindIndex(CWeakPtr<T>(_pItem_, nullptr, 0));
-    if (tIndex == static_cast<size_t>(-1))
-    {
-      for (size_t i = 0; i < m_tRegisteredItems; i++)
-      {
-        size_t tSlotIdx = m_lstDenseOrder[i];
-        if (m_lstInternalData[tSlotIdx].Get() == _pItem_)
-        {
-          tIndex = i;
-          break;
-        }
-      }
-    }
-
-    if (tIndex != static_cast<size_t>(-1) && RemoveAt(tIndex))
+    size_t tSlotIdx = GetSlotIdx(_pItem_);
+    if (tSlotIdx != s_tInvalidSlot && RemoveAt(m_lstSparseSlots[tSlotIdx].tDenseIndex))
     {
       _pItem_ = nullptr;
       return true;
@@ -183,8 +191,8 @@ namespace utils
       m_lstSparseSlots[tSlotIdx].tGeneration++;
     }
 
-    m_lstSlotStates.reset();
     m_tRegisteredItems = 0;
+    Init();
   }
 
   template<typename T, size_t MAX_ITEMS>
@@ -195,18 +203,8 @@ namespace utils
       return static_cast<size_t>(-1);
     }
 
-    const char* pBlock = reinterpret_cast<const char*>(_pItem.GetPtr());
-    const char* pBeginBlock = reinterpret_cast<const char*>(&m_lstInternalData[0]);
-
-    ptrdiff_t tDiff = pBlock - pBeginBlock;
-    ptrdiff_t tSlotIdx = tDiff / sizeof(TInternalData);
-
-    if (tSlotIdx < 0 || tSlotIdx >= static_cast<ptrdiff_t>(MAX_ITEMS))
-    {
-      return static_cast<size_t>(-1);
-    }
-
-    if (!m_lstSlotStates[tSlotIdx])
+    size_t tSlotIdx = GetSlotIdx(_pItem.GetPtr());
+    if (tSlotIdx == s_tInvalidSlot)
     {
       return static_cast<size_t>(-1);
     }
@@ -239,11 +237,17 @@ namespace utils
     m_lstSlotStates[tSlotIdxToDelete] = false;
     m_lstSparseSlots[tSlotIdxToDelete].tGeneration++;
 
-    for (size_t i = _tIndex; i < m_tRegisteredItems - 1; ++i)
+    // Push the slot to the free list
+    m_lstInternalData[tSlotIdxToDelete].SlotIdx = m_tFirstFreeSlot;
+    m_tFirstFreeSlot = tSlotIdxToDelete;
+
+    // Swap removal (the last item takes the dense index)
+    size_t tLastIndex = m_tRegisteredItems - 1;
+    if (_tIndex != tLastIndex)
     {
-      m_lstDenseOrder[i] = m_lstDenseOrder[i + 1];
-      size_t tMovedSlotIdx = m_lstDenseOrder[i];
-      m_lstSparseSlots[tMovedSlotIdx].tDenseIndex = i;
+      size_t tMovedSlotIdx = m_lstDenseOrder[tLastIndex];
+      m_lstDenseOrder[_tIndex] = tMovedSlotIdx;
+      m_lstSparseSlots[tMovedSlotIdx].tDenseIndex = _tIndex;
     }
 
     --m_tRegisteredItems;
@@ -0,0 +1,100 @@
+#include "WorkerPool.h"
+#include "Libs/Math/Math.h"
+
+namespace utils
+{
+  // ------------------------------------
+  CWorkerPool::CWorkerPool()
+  {
+    // One thread per core, the caller is the last one
+    uint32_t uCores = math::Max(std::thread::hardware_concurrency(), 1u);
+    for (uint32_t uIndex = 1; uIndex < uCores; ++uIndex)
+    {
+      m_lstThreads.emplace_back(&CWorkerPool::WorkerLoop, this, uIndex);
+    }
+  }
+  // ------------------------------------
+  CWorkerPool::~CWorkerPool()
+  {
+    {
+      std::lock_guard<std::mutex> oLock(m_oMutex);
+      m_bExit = true;
+    }
+    m_oWakeCondition.notify_all();
+
+    for (std::thread& rThread : m_lstThreads)
+    {
+      rThread.join();
+    }
+  }
+  // ------------------------------------
+  void CWorkerPool::ParallelFor(uint32_t _uCount, uint32_t _uBatchSize, const TTask& _oTask)
+  {
+    if (_uCount == 0)
+    {
+      return;
+    }
+
+    // Not worth waking up the workers
+    _uBatchSize = math::Max(_uBatchSize, 1u);
+    if (m_lstThreads.empty() || _uCount <= _uBatchSize)
+    {
+      _oTask(0, _uCount, 0);
+      return;
+    }
+
+    {
+      std::lock_guard<std::mutex> oLock(m_oMutex);
+      m_pTask = &_oTask;
+      m_uCount = _uCount;
+      m_uBatchSize = _uBatchSize;
+      m_uNextBatch = 0;
+      m_uBusyWorkers = static_cast<uint32_t>(m_lstThreads.size());
+      m_uTaskStamp++;
+    }
+    m_oWakeCondition.notify_all();
+
+    ExecuteBatches(0);
+
+    // Wait for the workers (the task must outlive them)
+    std::unique_lock<std::mutex> oLock(m_oMutex);
+    m_oDoneCondition.wait(oLock, [this] { return m_uBusyWorkers == 0; });
+    m_pTask = nullptr;
+  }
+  // ------------------------------------
+  void CWorkerPool::WorkerLoop(uint32_t _uWorkerIdx)
+  {
+    uint64_t uLastTaskStamp = 0;
+    while (true)
+    {
+      {
+        std::unique_lock<std::mutex> oLock(m_oMutex);
+        m_oWakeCondition.wait(oLock, [&] { return m_bExit || m_uTaskStamp != uLastTaskStamp; });
+        if (m_bExit)
+        {
+          return;
+        }
+        uLastTaskStamp = m_uTaskStamp;
+      }
+
+      ExecuteBatches(_uWorkerIdx);
+
+      {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        m_uBusyWorkers--;
+      }
+      m_oDoneCondition.notify_one();
+    }
+  }
+  // ------------------------------------
+  void CWorkerPool::ExecuteBatches(uint32_t _uWorkerIdx)
+  {
+    const uint32_t uBatchCount = (m_uCount + m_uBatchSize - 1) / m_uBatchSize;
+    for (uint32_t uBatch = m_uNextBatch++; uBatch < uBatchCount; uBatch = m_uNextBatch++)
+    {
+      uint32_t uBegin = uBatch * m_uBatchSize;
+      uint32_t uEnd = math::Min(uBegin + m_uBatchSize, m_uCount);
+      (*m_pTask)(uBegin, uEnd, _uWorkerIdx);
+    }
+  }
+}
@@ -0,0 +1,47 @@
+#pragma once
+#include "Libs/Utils/Singleton.h"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace utils
+{
+  // Persistent worker threads, the calling thread works too and waits for the whole range
+  class CWorkerPool : public utils::CSingleton<CWorkerPool, true>
+  {
+  public:
+    typedef std::function<void(uint32_t _uBegin, uint32_t _uEnd, uint32_t _uWorkerIdx)> TTask;
+
+  public:
+    CWorkerPool();
+    ~CWorkerPool();
+
+    // Splits [0, count) in batches, batches never cross a multiple of the batch size
+    void ParallelFor(uint32_t _uCount, uint32_t _uBatchSize, const TTask& _oTask);
+
+    // Worker 0 is the calling thread
+    inline uint32_t GetWorkerCount() const { return static_cast<uint32_t>(m_lstThreads.size()) + 1u; }
+
+  private:
+    void WorkerLoop(uint32_t _uWorkerIdx);
+    void ExecuteBatches(uint32_t _uWorkerIdx);
+
+  private:
+    std::vector<std::thread> m_lstThreads;
+    std::mutex m_oMutex;
+    std::condition_variable m_oWakeCondition;
+    std::condition_variable m_oDoneCondition;
+
+    // Current task
+    const TTask* m_pTask = nullptr;
+    uint32_t m_uCount = 0;
+    uint32_t m_uBatchSize = 1;
+    std::atomic<uint32_t> m_uNextBatch = 0;
+    uint32_t m_uBusyWorkers = 0;
+    uint64_t m_uTaskStamp = 0;
+    bool m_bExit = false;
+  };
+}
@@ -0,0 +1,96 @@
+#include "Tests/TestFramework.h"
+#include "Engine/Collisions/CollisionManager.h"
+#include "Engine/Collisions/BoxCollider.h"
+#include "Engine/Global/GlobalResources.h"
+#include <cmath>
+#include <vector>
+
+namespace internal_box_collider_allocation_tests
+{
+  static constexpr uint32_t s_uGridSize = 6u;
+  static constexpr uint32_t s_uPeriod = 30u; // Frames of a full oscillation
+  static constexpr uint32_t s_uRayCount = 16u;
+
+  // Boxes oscillate around their grid cell, neighbours touch each other during a part of the period
+  void MoveBoxes(const std::vector<collision::CCollider*>& _lstBoxes, uint32_t _uFrame)
+  {
+    const float fPhase = static_cast<float>(_uFrame % s_uPeriod) / static_cast<float>(s_uPeriod) * 6.2831853f;
+    for (uint32_t uIndex = 0; uIndex < _lstBoxes.size(); ++uIndex)
+    {
+      const float fX = static_cast<float>(uIndex % s_uGridSize) * 2.0f;
+      const float fZ = static_cast<float>(uIndex / s_uGridSize) * 2.0f;
+      const float fOffset = std::sin(fPhase + static_cast<float>(uIndex)) * 0.4f;
+      _lstBoxes[uIndex]->SetPos(math::CVector3(fX + fOffset, 0.0f, fZ - fOffset));
+      if (uIndex % 2u == 1u)
+      {
+        _lstBoxes[uIndex]->SetRot(math::CVector3(0.0f, fOffset * 45.0f, 15.0f));
+      }
+      _lstBoxes[uIndex]->RecalculateCollider();
+    }
+  }
+
+  // Rays across the grid, every one of them hits a box
+  uint32_t CastRays(collision::CCollisionManager* _pManager, const physics::CRay* _pRays, collision::TQueryHit* _pHits_)
+  {
+    uint32_t uHits = 0;
+    for (uint32_t uIndex = 0; uIndex < s_uRayCount; ++uIndex)
+    {
+      collision::THitEvent oHitEvent = collision::THitEvent();
+      uHits += _pManager->Raycast(_pRays[uIndex], 100.0f, oHitEvent) ? 1u : 0u;
+    }
+    return uHits + _pManager->RaycastBatch(_pRays, s_uRayCount, 100.0f, _pHits_);
+  }
+}
+
+// ------------------------------------
+TEST_CASE(BoxCollider_SteadyStateStepDoesNotAllocate)
+{
+  using namespace internal_box_collider_allocation_tests;
+  collision::CCollisionManager* pManager = collision::CCollisionManager::CreateSingleton();
+
+  // Half of the boxes are OBBs (SAT and OBB raycast paths)
+  std::vector<collision::CCollider*> lstBoxes;
+  for (uint32_t uIndex = 0; uIndex < s_uGridSize * s_uGridSize; ++uIndex)
+  {
+    collision::CBoxCollider* pBox = static_cast<collision::CBoxCollider*>(pManager->CreateCollider(collision::EColliderType::BOX_COLLIDER, nullptr));
+    pBox->SetOBB(uIndex % 2u == 1u);
+    pBox->SetSize(math::CVector3(1.8f, 1.0f, 1.8f));
+    lstBoxes.emplace_back(pBox);
+  }
+
+  physics::CRay lstRays[s_uRayCount];
+  collision::TQueryHit lstHits[s_uRayCount];
+  for (uint32_t uIndex = 0; uIndex < s_uRayCount; ++uIndex)
+  {
+    const float fZ = static_cast<float>(uIndex % s_uGridSize) * 2.0f;
+    lstRays[uIndex] = physics::CRay(math::CVector3(-10.0f, 0.0f, fZ), math::CVector3(1.0f, 0.0f, 0.0f));
+  }
+
+  // Warm up: the internal lists grow to their steady state size
+  uint32_t uFrame = 0;
+  for (; uFrame < s_uPeriod * 2u; ++uFrame)
+  {
+    MoveBoxes(lstBoxes, uFrame);
+    pManager->Update(1.0f / 60.0f);
+    CastRays(pManager, lstRays, lstHits);
+  }
+
+  // The global operator new (GlobalResources.cpp) counts every allocation
+  size_t tContacts = 0;
+  uint32_t uHits = 0;
+  const size_t tAllocCount = global::mem::s_oMemoryTracker.GetAllocCount();
+  for (; uFrame < s_uPeriod * 4u; ++uFrame)
+  {
+    MoveBoxes(lstBoxes, uFrame);
+    pManager->Update(1.0f / 60.0f);
+    uHits += CastRays(pManager, lstRays, lstHits);
+    tContacts += pManager->GetContacts().size();
+  }
+  TEST_CHECK(global::mem::s_oMemoryTracker.GetAllocCount() == tAllocCount);
+
+  // The measured steps did real work
+  TEST_CHECK(tContacts > 0);
+  TEST_CHECK(uHits == s_uRayCount * 2u * s_uPeriod * 2u);
+
+  collision::CCollisionManager::DestroySingleton();
+}
@@ -0,0 +1,110 @@
+#include "Tests/TestFramework.h"
+#include "Engine/Collisions/BoxCollider.h"
+#include "Libs/Math/Math.h"
+#include <cfloat>
+#include <random>
+
+namespace internal_box_collider_sat_tests
+{
+  static constexpr uint32_t s_uPairCount = 4000u;
+  static constexpr float s_fTolerance = 1e-3f;
+
+  void RandomizeBox(collision::CBoxCollider& _rBox_, std::mt19937& _rGenerator_)
+  {
+    std::uniform_real_distribution<float> oPos(-1.5f, 1.5f);
+    std::uniform_real_distribution<float> oSize(0.25f, 2.0f);
+    std::uniform_real_distribution<float> oRot(-180.0f, 180.0f);
+
+    // Some boxes stay axis aligned (parallel axes, null cross products)
+    const bool bAligned = _rGenerator_() % 4u == 0u;
+    _rBox_.SetOBB(true);
+    _rBox_.SetPos(math::CVector3(oPos(_rGenerator_), oPos(_rGenerator_), oPos(_rGenerator_)));
+    _rBox_.SetRot(bAligned ? math::CVector3::Zero : math::CVector3(oRot(_rGenerator_), oRot(_rGenerator_), oRot(_rGenerator_)));
+    _rBox_.SetSize(math::CVector3(oSize(_rGenerator_), oSize(_rGenerator_), oSize(_rGenerator_)));
+    _rBox_.RecalculateCollider();
+  }
+
+  // Reference: the 15 axes of CheckOBBCollision, every corner projected one by one
+  bool CheckScalarSAT(const collision::CBoxCollider& _rBox, const collision::CBoxCollider& _rOther, collision::THitEvent& _oHitEvent_)
+  {
+    const collision::CBoxCollider::TAxisDirectors lstAxisA = _rBox.GetAxisDirectors();
+    const collision::CBoxCollider::TAxisDirectors lstAxisB = _rOther.GetAxisDirectors();
+    math::CVector3 lstAxis[15];
+    uint32_t uAxisCount = 0;
+    for (const math::CVector3& v3Axis : lstAxisA)
+    {
+      lstAxis[uAxisCount++] = v3Axis;
+    }
+    for (const math::CVector3& v3Axis : lstAxisB)
+    {
+      lstAxis[uAxisCount++] = v3Axis;
+    }
+    for (const math::CVector3& v3AxisA : lstAxisA)
+    {
+      for (const math::CVector3& v3AxisB : lstAxisB)
+      {
+        lstAxis[uAxisCount++] = math::CVector3::Cross(v3AxisA, v3AxisB);
+      }
+    }
+
+    math::CVector3 v3ImpactPoint = math::CVector3::Zero;
+    math::CVector3 v3Normal = math::CVector3::Zero;
+    float fDepth = FLT_MAX;
+    const collision::CBoxCollider::TExtents& rExtents = _rBox.GetExtents();
+    const collision::CBoxCollider::TExtents& rOtherExtents = _rOther.GetExtents();
+    for (uint32_t uIndex = 0; uIndex < uAxisCount; ++uIndex)
+    {
+      if (math::SeparateAxisTheorem(rExtents.data(), rExtents.size(), rOtherExtents.data(), rOtherExtents.size(), lstAxis[uIndex], v3ImpactPoint, v3Normal, fDepth))
+      {
+        return false;
+      }
+    }
+
+    _oHitEvent_.ImpactPoint = v3ImpactPoint;
+    _oHitEvent_.Normal = v3Normal;
+    _oHitEvent_.Depth = std::abs(fDepth);
+    return true;
+  }
+
+  bool IsNear(const math::CVector3& _v3A, const math::CVector3& _v3B)
+  {
+    return (_v3A - _v3B).Magnitude() <= s_fTolerance;
+  }
+}
+
+// ------------------------------------
+TEST_CASE(BoxCollider_OBBMatchesScalarSAT)
+{
+  using namespace internal_box_collider_sat_tests;
+  std::mt19937 oGenerator(11u);
+  collision::CBoxCollider oBoxA(nullptr);
+  collision::CBoxCollider oBoxB(nullptr);
+
+  uint32_t uHits = 0;
+  uint32_t uMismatches = 0;
+  for (uint32_t uPair = 0; uPair < s_uPairCount; ++uPair)
+  {
+    RandomizeBox(oBoxA, oGenerator);
+    RandomizeBox(oBoxB, oGenerator);
+
+    collision::THitEvent oHitEvent = collision::THitEvent();
+    collision::THitEvent oScalarHitEvent = collision::THitEvent();
+    const bool bHit = oBoxA.CheckCollision(oBoxB, oHitEvent);
+    const bool bScalarHit = CheckScalarSAT(oBoxA, oBoxB, oScalarHitEvent);
+    if (bHit != bScalarHit)
+    {
+      uMismatches++;
+      continue;
+    }
+    if (bHit)
+    {
+      uHits++;
+      const bool bSameDepth = std::abs(oHitEvent.Depth - oScalarHitEvent.Depth) <= s_fTolerance;
+      uMismatches += bSameDepth && IsNear(oHitEvent.Normal, oScalarHitEvent.Normal) && IsNear(oHitEvent.ImpactPoint, oScalarHitEvent.ImpactPoint) ? 0u : 1u;
+    }
+  }
+
+  // Both results are checked: hits and separated pairs
+  TEST_CHECK(uMismatches == 0u);
+  TEST_CHECK(uHits > s_uPairCount / 10u && uHits < s_uPairCount);
+}
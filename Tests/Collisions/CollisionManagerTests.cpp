@@ -0,0 +1,156 @@
+#include "Tests/TestFramework.h"
+#include "Engine/Collisions/CollisionManager.h"
+#include "Engine/Collisions/BoxCollider.h"
+#include "Engine/Collisions/SphereCollider.h"
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace internal_collision_manager_tests
+{
+  typedef std::vector<std::pair<uint32_t, uint32_t>> TPairList;
+
+  collision::CCollider* CreateRandomCollider(collision::CCollisionManager* _pManager, std::mt19937& _rGenerator_)
+  {
+    std::uniform_real_distribution<float> oPos(-12.0f, 12.0f);
+    std::uniform_real_distribution<float> oSize(0.5f, 3.0f);
+    std::uniform_real_distribution<float> oAngle(0.0f, 90.0f);
+
+    collision::CCollider* pCollider = nullptr;
+    if (_rGenerator_() % 2u == 0u)
+    {
+      pCollider = _pManager->CreateCollider(collision::EColliderType::SPHERE_COLLIDER, nullptr);
+      static_cast<collision::CSphereCollider*>(pCollider)->SetRadius(oSize(_rGenerator_) * 0.5f);
+    }
+    else
+    {
+      pCollider = _pManager->CreateCollider(collision::EColliderType::BOX_COLLIDER, nullptr);
+      collision::CBoxCollider* pBox = static_cast<collision::CBoxCollider*>(pCollider);
+      pBox->SetSize(math::CVector3(oSize(_rGenerator_), oSize(_rGenerator_), oSize(_rGenerator_)));
+      if (_rGenerator_() % 3u == 0u)
+      {
+        pBox->SetOBB(true);
+        pBox->SetRot(math::CVector3(oAngle(_rGenerator_), oAngle(_rGenerator_), oAngle(_rGenerator_)));
+      }
+    }
+    pCollider->SetPos(math::CVector3(oPos(_rGenerator_), oPos(_rGenerator_), oPos(_rGenerator_)));
+    pCollider->RecalculateCollider();
+    return pCollider;
+  }
+
+  // Baseline step: every pair of the collider list, the first collider of the list runs the test
+  TPairList GetBruteForcePairs(collision::CCollisionManager* _pManager)
+  {
+    std::vector<collision::CCollider*> lstColliders;
+    for (size_t tIndex = 0; tIndex < _pManager->GetColliderCount(); ++tIndex)
+    {
+      lstColliders.emplace_back(_pManager->GetCollider(tIndex));
+    }
+    std::sort(lstColliders.begin(), lstColliders.end(), [](const collision::CCollider* _pA, const collision::CCollider* _pB)
+    {
+      return _pA->GetID() < _pB->GetID();
+    });
+
+    TPairList lstPairs;
+    for (size_t tI = 0; tI < lstColliders.size(); ++tI)
+    {
+      for (size_t tJ = tI + 1; tJ < lstColliders.size(); ++tJ)
+      {
+        collision::THitEvent oHitEvent = collision::THitEvent();
+        if (lstColliders[tI]->CheckCollision(*lstColliders[tJ], oHitEvent))
+        {
+          lstPairs.emplace_back(lstColliders[tI]->GetID(), lstColliders[tJ]->GetID());
+        }
+      }
+    }
+    return lstPairs;
+  }
+
+  TPairList GetContactPairs(const collision::CCollisionManager* _pManager)
+  {
+    TPairList lstPairs;
+    for (const collision::CCollisionManager::TContact& rContact : _pManager->GetContacts())
+    {
+      lstPairs.emplace_back(rContact.ColliderA->GetID(), rContact.ColliderB->GetID());
+    }
+    std::sort(lstPairs.begin(), lstPairs.end());
+    return lstPairs;
+  }
+}
+
+// ------------------------------------
+TEST_CASE(CollisionManager_BroadPhaseMatchesBruteForce)
+{
+  using namespace internal_collision_manager_tests;
+  static constexpr uint32_t s_uColliderCount = 150u;
+  static constexpr uint32_t s_uFrames = 40u;
+
+  for (collision::EBroadPhaseType eType : { collision::EBroadPhaseType::SWEEP_AND_PRUNE, collision::EBroadPhaseType::DYNAMIC_TREE })
+  {
+    collision::CCollisionManager* pManager = collision::CCollisionManager::CreateSingleton();
+    pManager->SetBroadPhaseType(eType);
+
+    std::mt19937 oGenerator(42u);
+    std::uniform_real_distribution<float> oStep(-0.4f, 0.4f);
+    std::vector<collision::CCollider*> lstColliders;
+    for (uint32_t uIndex = 0; uIndex < s_uColliderCount; ++uIndex)
+    {
+      lstColliders.emplace_back(CreateRandomCollider(pManager, oGenerator));
+    }
+
+    for (uint32_t uFrame = 0; uFrame < s_uFrames; ++uFrame)
+    {
+      // Every collider moves (no idle pairs), some of them are replaced
+      for (collision::CCollider*& pCollider : lstColliders)
+      {
+        if (uFrame % 10u == 5u && oGenerator() % 8u == 0u)
+        {
+          pManager->DestroyCollider(pCollider);
+          pCollider = CreateRandomCollider(pManager, oGenerator);
+          continue;
+        }
+        pCollider->SetPos(pCollider->GetPos() + math::CVector3(oStep(oGenerator), oStep(oGenerator), oStep(oGenerator)));
+        pCollider->RecalculateCollider();
+      }
+
+      pManager->Update(1.0f / 60.0f);
+      TEST_CHECK(GetContactPairs(pManager) == GetBruteForcePairs(pManager));
+    }
+
+    collision::CCollisionManager::DestroySingleton();
+  }
+}
+// ------------------------------------
+TEST_CASE(CollisionManager_SweepAxisSwitchMatchesBruteForce)
+{
+  using namespace internal_collision_manager_tests;
+  static constexpr uint32_t s_uColliderCount = 120u;
+  static constexpr uint32_t s_uFrames = 60u;
+  collision::CCollisionManager* pManager = collision::CCollisionManager::CreateSingleton();
+
+  // A row along X turns into a row along Z (the swept axis changes on the way), only the swept axis is sorted
+  std::mt19937 oGenerator(7u);
+  std::vector<collision::CCollider*> lstColliders;
+  for (uint32_t uIndex = 0; uIndex < s_uColliderCount; ++uIndex)
+  {
+    lstColliders.emplace_back(CreateRandomCollider(pManager, oGenerator));
+  }
+
+  for (uint32_t uFrame = 0; uFrame <= s_uFrames; ++uFrame)
+  {
+    const float fBlend = static_cast<float>(uFrame) / static_cast<float>(s_uFrames);
+    for (uint32_t uIndex = 0; uIndex < s_uColliderCount; ++uIndex)
+    {
+      const float fRow = (static_cast<float>(uIndex) - s_uColliderCount * 0.5f) * 0.8f;
+      const float fJitter = static_cast<float>(oGenerator() % 100u) * 0.01f;
+      lstColliders[uIndex]->SetPos(math::CVector3(fRow * (1.0f - fBlend) + fJitter, fJitter, fRow * fBlend - fJitter));
+      lstColliders[uIndex]->RecalculateCollider();
+    }
+
+    pManager->Update(1.0f / 60.0f);
+    TEST_CHECK(GetContactPairs(pManager) == GetBruteForcePairs(pManager));
+  }
+
+  collision::CCollisionManager::DestroySingleton();
+}
@@ -0,0 +1,112 @@
+#include "Tests/TestFramework.h"
+#include "Engine/Collisions/CollisionManager.h"
+#include "Engine/Collisions/SphereCollider.h"
+
+namespace internal_contact_cache_tests
+{
+  struct TEventRecorder
+  {
+    uint32_t EnterCount = 0;
+    uint32_t StayCount = 0;
+    uint32_t ExitCount = 0;
+
+    void OnEnter(const collision::THitEvent&) { EnterCount++; }
+    void OnStay(const collision::THitEvent&) { StayCount++; }
+    void OnExit(const collision::THitEvent&) { ExitCount++; }
+
+    void Bind(collision::CCollider* _pCollider)
+    {
+      _pCollider->SetOnCollisionEnter(collision::CCollider::TOnCollisionEvent(&TEventRecorder::OnEnter, this));
+      _pCollider->SetOnCollisionStay(collision::CCollider::TOnCollisionEvent(&TEventRecorder::OnStay, this));
+      _pCollider->SetOnCollisionExit(collision::CCollider::TOnCollisionEvent(&TEventRecorder::OnExit, this));
+    }
+    bool IsEqual(uint32_t _uEnterCount, uint32_t _uStayCount, uint32_t _uExitCount) const
+    {
+      return EnterCount == _uEnterCount && StayCount == _uStayCount && ExitCount == _uExitCount;
+    }
+  };
+
+  collision::CCollider* CreateSphere(collision::CCollisionManager* _pManager, const math::CVector3& _v3Pos)
+  {
+    collision::CCollider* pCollider = _pManager->CreateCollider(collision::EColliderType::SPHERE_COLLIDER, nullptr);
+    static_cast<collision::CSphereCollider*>(pCollider)->SetRadius(1.0f);
+    pCollider->SetPos(_v3Pos);
+    pCollider->RecalculateCollider();
+    return pCollider;
+  }
+
+  void MoveCollider(collision::CCollider* _pCollider_, const math::CVector3& _v3Pos)
+  {
+    _pCollider_->SetPos(_v3Pos);
+    _pCollider_->RecalculateCollider();
+  }
+}
+
+// ------------------------------------
+TEST_CASE(ContactCache_EnterStayExitEvents)
+{
+  using namespace internal_contact_cache_tests;
+  collision::CCollisionManager* pManager = collision::CCollisionManager::CreateSingleton();
+  collision::CCollider* pColliderA = CreateSphere(pManager, math::CVector3::Zero);
+  collision::CCollider* pColliderB = CreateSphere(pManager, math::CVector3(5.0f, 0.0f, 0.0f));
+
+  TEventRecorder oRecorderA, oRecorderB;
+  oRecorderA.Bind(pColliderA);
+  oRecorderB.Bind(pColliderB);
+
+  // Apart: no events
+  pManager->Update(1.0f / 60.0f);
+  TEST_CHECK(oRecorderA.IsEqual(0, 0, 0) && oRecorderB.IsEqual(0, 0, 0));
+
+  // Touching: one enter, then one stay per step (moving or not)
+  MoveCollider(pColliderB, math::CVector3(1.5f, 0.0f, 0.0f));
+  pManager->Update(1.0f / 60.0f);
+  TEST_CHECK(oRecorderA.IsEqual(1, 0, 0) && oRecorderB.IsEqual(1, 0, 0));
+
+  MoveCollider(pColliderB, math::CVector3(1.4f, 0.0f, 0.0f));
+  pManager->Update(1.0f / 60.0f);
+  pManager->Update(1.0f / 60.0f);
+  pManager->Update(1.0f / 60.0f);
+  TEST_CHECK(oRecorderA.IsEqual(1, 3, 0) && oRecorderB.IsEqual(1, 3, 0));
+
+  // Bounds apart again: one exit
+  MoveCollider(pColliderB, math::CVector3(5.0f, 0.0f, 0.0f));
+  pManager->Update(1.0f / 60.0f);
+  pManager->Update(1.0f / 60.0f);
+  TEST_CHECK(oRecorderA.IsEqual(1, 3, 1) && oRecorderB.IsEqual(1, 3, 1));
+
+  // Bounds overlapping but shapes apart (sphere corners): exit from the narrow-phase
+  MoveCollider(pColliderB, math::CVector3(1.5f, 0.0f, 0.0f));
+  pManager->Update(1.0f / 60.0f);
+  MoveCollider(pColliderB, math::CVector3(1.6f, 1.6f, 0.0f));
+  pManager->Update(1.0f / 60.0f);
+  TEST_CHECK(oRecorderA.IsEqual(2, 3, 2) && oRecorderB.IsEqual(2, 3, 2));
+
+  collision::CCollisionManager::DestroySingleton();
+}
+// ------------------------------------
+TEST_CASE(ContactCache_DestroyedColliderDropsContacts)
+{
+  using namespace internal_contact_cache_tests;
+  collision::CCollisionManager* pManager = collision::CCollisionManager::CreateSingleton();
+  collision::CCollider* pColliderA = CreateSphere(pManager, math::CVector3::Zero);
+  collision::CCollider* pColliderB = CreateSphere(pManager, math::CVector3(1.5f, 0.0f, 0.0f));
+
+  TEventRecorder oRecorderA;
+  oRecorderA.Bind(pColliderA);
+  pManager->Update(1.0f / 60.0f);
+  TEST_CHECK(pManager->GetContacts().size() == 1u);
+
+  // No contact keeps the destroyed collider, the next step sends nothing to the other one
+  pManager->DestroyCollider(pColliderB);
+  TEST_CHECK(pColliderB == nullptr && pManager->GetContacts().empty());
+  pManager->Update(1.0f / 60.0f);
+  TEST_CHECK(oRecorderA.IsEqual(1, 0, 0) && pManager->GetContacts().empty());
+
+  // A new collider at the same place is a new contact
+  pColliderB = CreateSphere(pManager, math::CVector3(1.5f, 0.0f, 0.0f));
+  pManager->Update(1.0f / 60.0f);
+  TEST_CHECK(oRecorderA.IsEqual(2, 0, 0) && pManager->GetContacts().size() == 1u);
+
+  collision::CCollisionManager::DestroySingleton();
+}
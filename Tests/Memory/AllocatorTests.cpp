@@ -0,0 +1,176 @@
+#include "Tests/TestFramework.h"
+#include "Libs/Memory/Allocator.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace internal_allocator_tests
+{
+  struct TLiveBlock
+  {
+    unsigned char* Data = nullptr;
+    size_t Size = 0;
+    unsigned char Tag = 0;
+  };
+
+  // Mostly small blocks, some big ones and some over-aligned ones
+  bool AllocRandomBlock(mem::CAllocator& _rAllocator_, std::mt19937& _rGenerator_, std::vector<TLiveBlock>& _lstBlocks_)
+  {
+    const size_t tSize = (_rGenerator_() % 8u == 0u) ? 1u + _rGenerator_() % 65536u : 1u + _rGenerator_() % 256u;
+    const size_t tAlignment = (_rGenerator_() % 10u == 0u) ? (size_t(16u) << (_rGenerator_() % 5u)) : mem::s_uBYTE_ALIGNMENT;
+    unsigned char* pData = static_cast<unsigned char*>(_rAllocator_.alloc(tSize, tAlignment));
+    if (!pData)
+    {
+      return true;
+    }
+
+    TLiveBlock oBlock = TLiveBlock();
+    oBlock.Data = pData;
+    oBlock.Size = tSize;
+    oBlock.Tag = static_cast<unsigned char>(_rGenerator_());
+    std::memset(oBlock.Data, oBlock.Tag, oBlock.Size);
+    _lstBlocks_.emplace_back(oBlock);
+    return (reinterpret_cast<uintptr_t>(pData) & (tAlignment - 1u)) == 0u && _rAllocator_.get_block_size(pData) >= tSize;
+  }
+
+  // The block data was not overwritten by the allocator or by a neighbour
+  bool FreeRandomBlock(mem::CAllocator& _rAllocator_, std::mt19937& _rGenerator_, std::vector<TLiveBlock>& _lstBlocks_)
+  {
+    const size_t tIndex = _rGenerator_() % _lstBlocks_.size();
+    const TLiveBlock oBlock = _lstBlocks_[tIndex];
+    _lstBlocks_[tIndex] = _lstBlocks_.back();
+    _lstBlocks_.pop_back();
+
+    bool bOk = true;
+    for (size_t tByte = 0; tByte < oBlock.Size && bOk; ++tByte)
+    {
+      bOk = oBlock.Data[tByte] == oBlock.Tag;
+    }
+    return _rAllocator_.free(oBlock.Data) && bOk;
+  }
+}
+
+// ------------------------------------
+TEST_CASE(Allocator_RandomizedStress)
+{
+  using namespace internal_allocator_tests;
+  mem::CAllocator oAllocator(64u << 20u);
+  std::mt19937 oGenerator(7u);
+  std::vector<TLiveBlock> lstBlocks;
+
+  // Fill
+  bool bOk = true;
+  for (uint32_t uIndex = 0; uIndex < 4000u; ++uIndex)
+  {
+    bOk &= AllocRandomBlock(oAllocator, oGenerator, lstBlocks);
+  }
+  TEST_CHECK(bOk && oAllocator.check_integrity());
+  TEST_CHECK(oAllocator.get_alloc_count() == lstBlocks.size());
+
+  // Free half of the blocks in random order (holes everywhere)
+  while (lstBlocks.size() > 2000u)
+  {
+    bOk &= FreeRandomBlock(oAllocator, oGenerator, lstBlocks);
+  }
+  TEST_CHECK(bOk && oAllocator.check_integrity());
+  TEST_CHECK(oAllocator.get_fragmentation() > 0.0f);
+
+  // Churn: allocs, aligned allocs and frees mixed
+  for (uint32_t uIndex = 0; uIndex < 300000u; ++uIndex)
+  {
+    if (lstBlocks.size() < 5000u && (lstBlocks.empty() || oGenerator() % 100u < 55u))
+    {
+      bOk &= AllocRandomBlock(oAllocator, oGenerator, lstBlocks);
+    }
+    else
+    {
+      bOk &= FreeRandomBlock(oAllocator, oGenerator, lstBlocks);
+    }
+  }
+  TEST_CHECK(bOk && oAllocator.check_integrity());
+  TEST_CHECK(oAllocator.get_alloc_count() == lstBlocks.size());
+  TEST_CHECK(oAllocator.get_high_water_mark() >= oAllocator.get_allocated_size());
+
+  // Free everything: the neighbours are merged back into one block
+  while (!lstBlocks.empty())
+  {
+    bOk &= FreeRandomBlock(oAllocator, oGenerator, lstBlocks);
+  }
+  TEST_CHECK(bOk && oAllocator.check_integrity());
+  TEST_CHECK(oAllocator.get_free_blocks() == 1u && oAllocator.get_allocated_size() == 0u && oAllocator.get_alloc_count() == 0u);
+  TEST_CHECK(oAllocator.get_fragmentation() == 0.0f);
+  TEST_CHECK(oAllocator.alloc(32u << 20u) != nullptr);
+
+  // Foreign pointers are rejected
+  int iValue = 0;
+  TEST_CHECK(!oAllocator.free(&iValue) && !oAllocator.free(nullptr));
+}
+// ------------------------------------
+TEST_CASE(Allocator_Exhaustion)
+{
+  mem::CAllocator oAllocator(1024u);
+  std::vector<void*> lstBlocks;
+  while (void* pData = oAllocator.alloc(24u))
+  {
+    lstBlocks.emplace_back(pData);
+  }
+  TEST_CHECK(!lstBlocks.empty() && oAllocator.check_integrity());
+
+  for (void* pData : lstBlocks)
+  {
+    TEST_CHECK(oAllocator.free(pData));
+  }
+  TEST_CHECK(oAllocator.check_integrity() && oAllocator.get_free_blocks() == 1u);
+}
+// ------------------------------------
+TEST_BENCHMARK(Allocator_ChurnVsMalloc)
+{
+  static constexpr uint32_t s_uOperations = 2000000u;
+  static constexpr size_t s_tSlots = 4096u;
+
+  // Same sequence for both: every operation replaces the block of a random slot
+  std::mt19937 oGenerator(3u);
+  std::vector<size_t> lstSizes(s_uOperations);
+  std::vector<size_t> lstSlotIndices(s_uOperations);
+  for (uint32_t uIndex = 0; uIndex < s_uOperations; ++uIndex)
+  {
+    lstSizes[uIndex] = 16u + oGenerator() % 512u;
+    lstSlotIndices[uIndex] = oGenerator() % s_tSlots;
+  }
+  std::vector<void*> lstSlots(s_tSlots, nullptr);
+
+  mem::CAllocator oAllocator(256u << 20u);
+  auto oBegin = std::chrono::steady_clock::now();
+  for (uint32_t uIndex = 0; uIndex < s_uOperations; ++uIndex)
+  {
+    void*& rSlot = lstSlots[lstSlotIndices[uIndex]];
+    oAllocator.free(rSlot);
+    rSlot = oAllocator.alloc(lstSizes[uIndex]);
+  }
+  const double dAllocatorMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - oBegin).count();
+  const float fFragmentation = oAllocator.get_fragmentation();
+  TEST_CHECK(oAllocator.check_integrity());
+  for (void*& rSlot : lstSlots)
+  {
+    TEST_CHECK(rSlot && oAllocator.free(rSlot));
+    rSlot = nullptr;
+  }
+
+  oBegin = std::chrono::steady_clock::now();
+  for (uint32_t uIndex = 0; uIndex < s_uOperations; ++uIndex)
+  {
+    void*& rSlot = lstSlots[lstSlotIndices[uIndex]];
+    std::free(rSlot);
+    rSlot = std::malloc(lstSizes[uIndex]);
+  }
+  const double dMallocMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - oBegin).count();
+  for (void* pSlot : lstSlots)
+  {
+    std::free(pSlot);
+  }
+
+  printf("  %u free/alloc pairs: CAllocator %.2f ms, malloc %.2f ms (fragmentation %.3f)\n", s_uOperations, dAllocatorMs, dMallocMs, fFragmentation);
+}
@@ -0,0 +1,75 @@
+#include "Tests/TestFramework.h"
+#include "Engine/Collisions/CollisionManager.h"
+#include "Engine/Collisions/BoxCollider.h"
+#include "Engine/Physics/PhysicsManager.h"
+
+namespace internal_continuous_collision_tests
+{
+  // Owner of a body, the motions of the physics step are applied to its collider (entity sync)
+  struct TBodyOwner
+  {
+    collision::CCollider* Collider = nullptr;
+  };
+
+  collision::CCollider* CreateStaticBox(collision::CCollisionManager* _pManager, const math::CVector3& _v3Pos, const math::CVector3& _v3Size)
+  {
+    collision::CBoxCollider* pBox = static_cast<collision::CBoxCollider*>(_pManager->CreateCollider(collision::EColliderType::BOX_COLLIDER, nullptr));
+    pBox->SetSize(_v3Size);
+    pBox->SetPos(_v3Pos);
+    pBox->SetStatic(true);
+    pBox->RecalculateCollider();
+    return pBox;
+  }
+
+  void Step(collision::CCollisionManager* _pCollisionManager, physics::CPhysicsManager* _pPhysicsManager, float _fDeltaTime)
+  {
+    _pPhysicsManager->Update(_fDeltaTime);
+    for (const physics::CPhysicsManager::TMotion& rMotion : _pPhysicsManager->GetMotions())
+    {
+      collision::CCollider* pCollider = static_cast<TBodyOwner*>(rMotion.Owner)->Collider;
+      pCollider->SetPos(pCollider->GetPos() + rMotion.Displacement);
+      pCollider->SetRot(pCollider->GetRot() + rMotion.Rotation);
+      pCollider->RecalculateCollider();
+    }
+    _pCollisionManager->Update(_fDeltaTime);
+  }
+}
+
+// ------------------------------------
+TEST_CASE(ContinuousCollision_SlidingBoxStopsAtThinWall)
+{
+  using namespace internal_continuous_collision_tests;
+  collision::CCollisionManager* pCollisionManager = collision::CCollisionManager::CreateSingleton();
+  physics::CPhysicsManager* pPhysicsManager = physics::CPhysicsManager::CreateSingleton();
+
+  // Floor top at y = 0, thin wall 20 m ahead (a step at 150 m/s is 2.5 m)
+  CreateStaticBox(pCollisionManager, math::CVector3(0.0f, -0.5f, 0.0f), math::CVector3(200.0f, 1.0f, 20.0f));
+  const collision::CCollider* pWall = CreateStaticBox(pCollisionManager, math::CVector3(20.0f, 2.0f, 0.0f), math::CVector3(0.1f, 4.0f, 20.0f));
+
+  // Box resting on the floor (the floor overlaps it at the start of every sweep)
+  TBodyOwner oOwner;
+  oOwner.Collider = pCollisionManager->CreateCollider(collision::EColliderType::BOX_COLLIDER, &oOwner);
+  static_cast<collision::CBoxCollider*>(oOwner.Collider)->SetSize(math::CVector3(1.0f, 1.0f, 1.0f));
+  oOwner.Collider->SetPos(math::CVector3(0.0f, 0.49f, 0.0f));
+  oOwner.Collider->RecalculateCollider();
+  utils::CWeakPtr<physics::CRigidbody> wpRigidbody = pPhysicsManager->CreateRigidbody(physics::ERigidbodyType::DYNAMIC, &oOwner);
+  oOwner.Collider->SetRigidbody(wpRigidbody);
+  pCollisionManager->Update(1.0f / 60.0f);
+
+  wpRigidbody->SetVelocity(math::CVector3(150.0f, 0.0f, 0.0f));
+  const float fWallFace = pWall->GetPos().x - 0.05f;
+  float fMaxX = oOwner.Collider->GetPos().x;
+  for (uint32_t uStep = 0; uStep < 60u; ++uStep)
+  {
+    Step(pCollisionManager, pPhysicsManager, 1.0f / 60.0f);
+    fMaxX = math::Max(fMaxX, oOwner.Collider->GetPos().x);
+  }
+
+  // Stopped by the wall, never through it, and still on the floor
+  TEST_CHECK(fMaxX + 0.5f <= fWallFace + 0.05f);
+  TEST_CHECK(fMaxX > fWallFace - 2.0f);
+  TEST_CHECK(oOwner.Collider->GetPos().y > 0.0f);
+
+  physics::CPhysicsManager::DestroySingleton();
+  collision::CCollisionManager::DestroySingleton();
+}
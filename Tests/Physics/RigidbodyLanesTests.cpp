@@ -0,0 +1,95 @@
+#include "Tests/TestFramework.h"
+#include "Engine/Physics/RigidbodyLanes.h"
+#include <cstring>
+#include <memory>
+#include <random>
+
+namespace internal_rigidbody_lanes_tests
+{
+  enum class EBodyState : uint32_t { ACTIVE, KINEMATIC, SLEEPING };
+
+  // Kinematic and sleeping bodies both have ACTIVE = 0, sleeping ones keep their velocities
+  EBodyState GetBodyState(uint32_t _uLaneIdx)
+  {
+    return (_uLaneIdx % 3u) == 1u ? EBodyState::KINEMATIC : ((_uLaneIdx % 5u) == 2u ? EBodyState::SLEEPING : EBodyState::ACTIVE);
+  }
+
+  void FillLanes(physics::CRigidbodyLanes& _rLanes_, uint32_t _uBodies)
+  {
+    std::mt19937 oGenerator(1234u);
+    std::uniform_real_distribution<float> oValue(-10.0f, 10.0f);
+    std::uniform_real_distribution<float> oPositive(0.0f, 2.0f);
+    auto oRandomVector = [&]() { return math::CVector3(oValue(oGenerator), oValue(oGenerator), oValue(oGenerator)); };
+
+    for (uint32_t uIndex = 0; uIndex < _uBodies; ++uIndex)
+    {
+      const uint32_t uLaneIdx = _rLanes_.Add(nullptr);
+      const EBodyState eState = GetBodyState(uLaneIdx);
+
+      _rLanes_.SetVector(physics::CRigidbodyLanes::VELOCITY_X, uLaneIdx, eState == EBodyState::KINEMATIC ? math::CVector3::Zero : oRandomVector());
+      _rLanes_.SetVector(physics::CRigidbodyLanes::ANGULAR_VELOCITY_X, uLaneIdx, oRandomVector());
+      _rLanes_.SetVector(physics::CRigidbodyLanes::ACCELERATION_X, uLaneIdx, oRandomVector());
+      _rLanes_.SetVector(physics::CRigidbodyLanes::TORQUE_X, uLaneIdx, oRandomVector());
+
+      physics::TInertiaTensor oInvInertia = physics::TInertiaTensor();
+      oInvInertia.XX = oPositive(oGenerator); oInvInertia.YY = oPositive(oGenerator); oInvInertia.ZZ = oPositive(oGenerator);
+      oInvInertia.XY = oValue(oGenerator) * 0.01f; oInvInertia.XZ = oValue(oGenerator) * 0.01f; oInvInertia.YZ = oValue(oGenerator) * 0.01f;
+      _rLanes_.SetInvInertia(uLaneIdx, oInvInertia);
+
+      _rLanes_.Get(physics::CRigidbodyLanes::INV_MASS, uLaneIdx) = eState == EBodyState::KINEMATIC ? 0.0f : oPositive(oGenerator);
+      _rLanes_.Get(physics::CRigidbodyLanes::DRAG, uLaneIdx) = oPositive(oGenerator);
+      _rLanes_.Get(physics::CRigidbodyLanes::ACTIVE, uLaneIdx) = eState == EBodyState::ACTIVE ? 1.0f : 0.0f;
+    }
+  }
+
+  bool AreLanesEqual(const physics::CRigidbodyLanes& _rLanesA, const physics::CRigidbodyLanes& _rLanesB)
+  {
+    // Bit comparison of every lane, unused ones included
+    for (uint32_t uLane = 0; uLane < physics::CRigidbodyLanes::COUNT; ++uLane)
+    {
+      const physics::CRigidbodyLanes::ELane eLane = static_cast<physics::CRigidbodyLanes::ELane>(uLane);
+      if (std::memcmp(&_rLanesA.Get(eLane, 0), &_rLanesB.Get(eLane, 0), sizeof(float) * physics::CRigidbodyLanes::s_uMaxBodies) != 0)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+}
+
+// ------------------------------------
+TEST_CASE(RigidbodyLanes_SimdMatchesScalar)
+{
+  using namespace internal_rigidbody_lanes_tests;
+  const math::CVector3 v3Gravity(0.0f, -9.81f, 0.0f);
+  const float lstDeltaTimes[] = { 1.0f / 60.0f, 1.0f / 240.0f, 1.0f / 30.0f, 0.0f };
+
+  // Full last group and partial one (unused lanes must stay untouched)
+  for (uint32_t uBodies : { 1u, 61u, physics::CRigidbodyLanes::s_uMaxBodies })
+  {
+    std::unique_ptr<physics::CRigidbodyLanes> pSimd = std::make_unique<physics::CRigidbodyLanes>();
+    FillLanes(*pSimd, uBodies);
+    std::unique_ptr<physics::CRigidbodyLanes> pScalar = std::make_unique<physics::CRigidbodyLanes>(*pSimd);
+    const std::unique_ptr<physics::CRigidbodyLanes> pInitial = std::make_unique<physics::CRigidbodyLanes>(*pSimd);
+
+    for (float fDeltaTime : lstDeltaTimes)
+    {
+      pSimd->Integrate(fDeltaTime, v3Gravity);
+      pScalar->IntegrateScalar(fDeltaTime, v3Gravity);
+      TEST_CHECK(AreLanesEqual(*pSimd, *pScalar));
+    }
+
+    for (uint32_t uLaneIdx = 0; uLaneIdx < uBodies; ++uLaneIdx)
+    {
+      const bool bActive = GetBodyState(uLaneIdx) == EBodyState::ACTIVE;
+      const math::CVector3 v3Velocity = pSimd->GetVector(physics::CRigidbodyLanes::VELOCITY_X, uLaneIdx);
+      const math::CVector3 v3InitialVelocity = pInitial->GetVector(physics::CRigidbodyLanes::VELOCITY_X, uLaneIdx);
+      const math::CVector3 v3Acceleration = pSimd->GetVector(physics::CRigidbodyLanes::ACCELERATION_X, uLaneIdx);
+      const math::CVector3 v3InitialAcceleration = pInitial->GetVector(physics::CRigidbodyLanes::ACCELERATION_X, uLaneIdx);
+
+      // Active lanes consume their forces, kinematic and sleeping lanes are left as they are
+      TEST_CHECK(bActive ? (v3Velocity != v3InitialVelocity) : (v3Velocity == v3InitialVelocity));
+      TEST_CHECK(bActive ? (v3Acceleration == math::CVector3::Zero) : (v3Acceleration == v3InitialAcceleration));
+    }
+  }
+}
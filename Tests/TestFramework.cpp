@@ -0,0 +1,56 @@
+#include "TestFramework.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+namespace tests
+{
+  // ------------------------------------
+  CTestRegistry& CTestRegistry::GetInstance()
+  {
+    static CTestRegistry s_oRegistry;
+    return s_oRegistry;
+  }
+  // ------------------------------------
+  void CTestRegistry::Register(const char* _sName, TTestFunc _pFunc, bool _bBenchmark)
+  {
+    TTestCase oTestCase = TTestCase();
+    oTestCase.Name = _sName;
+    oTestCase.Func = _pFunc;
+    oTestCase.Benchmark = _bBenchmark;
+    m_lstTestCases.emplace_back(oTestCase);
+  }
+  // ------------------------------------
+  void CTestRegistry::ReportFailure(const char* _sExpression, const char* _sFile, int _iLine)
+  {
+    printf("  %s(%d): check failed: %s\n", _sFile, _iLine, _sExpression);
+    m_uFailedChecks++;
+  }
+  // ------------------------------------
+  int CTestRegistry::Run(const char* _sFilter, bool _bBenchmarks)
+  {
+    int iFailedCases = 0;
+    uint32_t uRunCases = 0;
+    for (const TTestCase& rTestCase : m_lstTestCases)
+    {
+      if (rTestCase.Benchmark != _bBenchmarks || (_sFilter && !std::strstr(rTestCase.Name, _sFilter)))
+      {
+        continue;
+      }
+
+      printf("[ RUN  ] %s\n", rTestCase.Name);
+      m_uFailedChecks = 0;
+      const auto oBegin = std::chrono::steady_clock::now();
+      rTestCase.Func();
+      const float fMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - oBegin).count();
+
+      const bool bOk = m_uFailedChecks == 0;
+      printf("[ %s ] %s (%.2f ms)\n", bOk ? " OK " : "FAIL", rTestCase.Name, fMs);
+      iFailedCases += bOk ? 0 : 1;
+      uRunCases++;
+    }
+
+    printf("%u cases, %d failed\n", uRunCases, iFailedCases);
+    return iFailedCases;
+  }
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+namespace tests
+{
+  typedef void(*TTestFunc)();
+
+  // Test cases register themselves before main. Benchmarks only run with --bench (they still check their results)
+  class CTestRegistry
+  {
+  public:
+    struct TTestCase
+    {
+      const char* Name = nullptr;
+      TTestFunc Func = nullptr;
+      bool Benchmark = false;
+    };
+
+  public:
+    static CTestRegistry& GetInstance();
+
+    void Register(const char* _sName, TTestFunc _pFunc, bool _bBenchmark);
+    void ReportFailure(const char* _sExpression, const char* _sFile, int _iLine);
+
+    // Runs the cases whose name contains the filter (nullptr = all), returns the failed cases
+    int Run(const char* _sFilter, bool _bBenchmarks);
+
+  private:
+    std::vector<TTestCase> m_lstTestCases;
+    uint32_t m_uFailedChecks = 0;
+  };
+
+  class CTestRegistrar
+  {
+  public:
+    CTestRegistrar(const char* _sName, TTestFunc _pFunc, bool _bBenchmark)
+    {
+      CTestRegistry::GetInstance().Register(_sName, _pFunc, _bBenchmark);
+    }
+  };
+}
+
+#define TEST_CASE(_Name) \
+  static void _Name(); \
+  static tests::CTestRegistrar s_o##_Name##Registrar(#_Name, &_Name, false); \
+  static void _Name()
+
+#define TEST_BENCHMARK(_Name) \
+  static void _Name(); \
+  static tests::CTestRegistrar s_o##_Name##Registrar(#_Name, &_Name, true); \
+  static void _Name()
+
+#define TEST_CHECK(x) do { \
+    if (!(x)) { tests::CTestRegistry::GetInstance().ReportFailure(#x, __FILE__, __LINE__); } \
+} while(0)
@@ -0,0 +1,129 @@
+#include "Tests/TestFramework.h"
+#include "Libs/Utils/ChunkedPool.h"
+#include <vector>
+
+namespace internal_chunked_pool_tests
+{
+  static constexpr size_t s_tChunkSize = 64;
+  static constexpr size_t s_tItemCount = s_tChunkSize * 8 + 20; // Nine chunks, the last one partially used
+  static constexpr size_t s_tRemoveStep = 7; // Every Nth item is removed and created again
+
+  struct TItem
+  {
+    explicit TItem(int _iValue) : Value(_iValue) {}
+    ~TItem() { Value = -1; }
+    int Value = 0;
+  };
+  typedef utils::CChunkedPool<TItem, s_tChunkSize> TPool;
+
+  void FillPool(TPool& _rPool_, std::vector<utils::CWeakPtr<TItem>>& _lstHandles_, size_t _tCount)
+  {
+    for (size_t tIndex = _lstHandles_.size(); tIndex < _tCount; ++tIndex)
+    {
+      _lstHandles_.emplace_back(_rPool_.Create(static_cast<int>(tIndex)));
+    }
+  }
+
+  // Every handle points to its own value and the dense order has every item once
+  bool IsPoolConsistent(TPool& _rPool, const std::vector<utils::CWeakPtr<TItem>>& _lstHandles)
+  {
+    for (size_t tIndex = 0; tIndex < _lstHandles.size(); ++tIndex)
+    {
+      const utils::CWeakPtr<TItem>& rHandle = _lstHandles[tIndex];
+      const size_t tDenseIdx = _rPool.FindIndex(rHandle);
+      if (!rHandle.IsValid() || rHandle->Value != static_cast<int>(tIndex) || tDenseIdx >= _rPool.GetSize() || _rPool[tDenseIdx].GetPtr() != rHandle.GetPtr())
+      {
+        return false;
+      }
+    }
+    return _rPool.GetSize() == _lstHandles.size();
+  }
+}
+
+// ------------------------------------
+TEST_CASE(ChunkedPool_WeakPtrGenerations)
+{
+  using namespace internal_chunked_pool_tests;
+  TPool oPool;
+  std::vector<utils::CWeakPtr<TItem>> lstHandles;
+  FillPool(oPool, lstHandles, s_tItemCount);
+  TEST_CHECK(oPool.GetChunkCount() == (s_tItemCount + s_tChunkSize - 1) / s_tChunkSize);
+  TEST_CHECK(IsPoolConsistent(oPool, lstHandles));
+
+  std::vector<TItem*> lstItems;
+  for (const utils::CWeakPtr<TItem>& rHandle : lstHandles)
+  {
+    lstItems.emplace_back(rHandle.GetPtr());
+  }
+
+  // Swap removal in every chunk: the last dense items are moved into the holes
+  std::vector<utils::CWeakPtr<TItem>> lstRemoved;
+  for (size_t tIndex = 0; tIndex < s_tItemCount; tIndex += s_tRemoveStep)
+  {
+    TEST_CHECK(oPool.Remove(lstHandles[tIndex]));
+    lstRemoved.emplace_back(lstHandles[tIndex]);
+  }
+  for (const utils::CWeakPtr<TItem>& rRemoved : lstRemoved)
+  {
+    TEST_CHECK(!rRemoved.IsValid() && rRemoved.GetPtr() == nullptr);
+    TEST_CHECK(!oPool.Remove(rRemoved));
+  }
+
+  // Moved items keep their slot: same handle, same address, new dense index
+  uint32_t uMovedItems = 0;
+  for (size_t tIndex = 0; tIndex < s_tItemCount; ++tIndex)
+  {
+    if (tIndex % s_tRemoveStep != 0)
+    {
+      const size_t tDenseIdx = oPool.FindIndex(lstHandles[tIndex]);
+      TEST_CHECK(lstHandles[tIndex].GetPtr() == lstItems[tIndex] && lstItems[tIndex]->Value == static_cast<int>(tIndex));
+      TEST_CHECK(tDenseIdx < oPool.GetSize() && oPool[tDenseIdx].GetPtr() == lstItems[tIndex]);
+      uMovedItems += tDenseIdx != tIndex ? 1u : 0u;
+    }
+  }
+  TEST_CHECK(uMovedItems > 0u);
+
+  // Raw pointers: a live item is removed once, items of another pool are rejected
+  TPool oOtherPool;
+  utils::CWeakPtr<TItem> wpOther = oOtherPool.Create(0);
+  TItem* pOther = wpOther.GetPtr();
+  TEST_CHECK(!oPool.Remove(pOther) && pOther != nullptr);
+
+  TItem* pItem = lstItems[1];
+  TEST_CHECK(oPool.Remove(pItem) && pItem == nullptr && !lstHandles[1].IsValid());
+  pItem = lstItems[1];
+  TEST_CHECK(!oPool.Remove(pItem) && pItem != nullptr);
+  lstRemoved.emplace_back(lstHandles[1]);
+
+  // The freed slots are reused (no new chunk), the old handles stay invalid
+  for (size_t tIndex = 0; tIndex < s_tItemCount; tIndex += s_tRemoveStep)
+  {
+    lstHandles[tIndex] = oPool.Create(static_cast<int>(tIndex));
+  }
+  lstHandles[1] = oPool.Create(1);
+  TEST_CHECK(oPool.GetChunkCount() == (s_tItemCount + s_tChunkSize - 1) / s_tChunkSize);
+  for (const utils::CWeakPtr<TItem>& rRemoved : lstRemoved)
+  {
+    TEST_CHECK(!rRemoved.IsValid());
+  }
+  TEST_CHECK(IsPoolConsistent(oPool, lstHandles));
+
+  // Growing again: new chunks, the items of the old ones are not moved
+  FillPool(oPool, lstHandles, s_tItemCount * 2);
+  TEST_CHECK(oPool.GetChunkCount() == (s_tItemCount * 2 + s_tChunkSize - 1) / s_tChunkSize);
+  for (size_t tIndex = 0; tIndex < s_tItemCount; ++tIndex)
+  {
+    if (tIndex % s_tRemoveStep != 0 && tIndex != 1)
+    {
+      TEST_CHECK(lstHandles[tIndex].GetPtr() == lstItems[tIndex]);
+    }
+  }
+  TEST_CHECK(IsPoolConsistent(oPool, lstHandles));
+
+  oPool.Clear();
+  for (const utils::CWeakPtr<TItem>& rHandle : lstHandles)
+  {
+    TEST_CHECK(!rHandle.IsValid());
+  }
+  TEST_CHECK(oPool.IsEmpty() && oPool.GetChunkCount() == (s_tItemCount * 2 + s_tChunkSize - 1) / s_tChunkSize);
+}
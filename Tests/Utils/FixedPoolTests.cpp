@@ -0,0 +1,137 @@
+#include "Tests/TestFramework.h"
+#include "Libs/Utils/FixedPool.h"
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+namespace internal_fixed_pool_tests
+{
+  static constexpr size_t s_tMaxItems = 4096;
+  static constexpr size_t s_tRemoveStep = 7; // Every Nth item is removed and created again
+
+  struct TItem
+  {
+    explicit TItem(int _iValue) : Value(_iValue) {}
+    ~TItem() { Value = -1; }
+    int Value = 0;
+  };
+  typedef utils::CFixedPool<TItem, s_tMaxItems> TPool;
+
+  void FillPool(TPool& _rPool_, std::vector<utils::CWeakPtr<TItem>>& _lstHandles_)
+  {
+    for (size_t tIndex = 0; tIndex < s_tMaxItems; ++tIndex)
+    {
+      _lstHandles_.emplace_back(_rPool_.Create(static_cast<int>(tIndex)));
+    }
+  }
+
+  // Every handle points to its own value and the dense order has every item once
+  bool IsPoolConsistent(TPool& _rPool, const std::vector<utils::CWeakPtr<TItem>>& _lstHandles)
+  {
+    for (size_t tIndex = 0; tIndex < _lstHandles.size(); ++tIndex)
+    {
+      const utils::CWeakPtr<TItem>& rHandle = _lstHandles[tIndex];
+      const size_t tDenseIdx = _rPool.FindIndex(rHandle);
+      if (!rHandle.IsValid() || rHandle->Value != static_cast<int>(tIndex) || tDenseIdx >= _rPool.GetSize() || _rPool[tDenseIdx].GetPtr() != rHandle.GetPtr())
+      {
+        return false;
+      }
+    }
+    return _rPool.GetSize() == _lstHandles.size();
+  }
+}
+
+// ------------------------------------
+TEST_CASE(FixedPool_WeakPtrGenerations)
+{
+  using namespace internal_fixed_pool_tests;
+  std::unique_ptr<TPool> pPool = std::make_unique<TPool>();
+  std::vector<utils::CWeakPtr<TItem>> lstHandles;
+  FillPool(*pPool, lstHandles);
+
+  std::vector<TItem*> lstItems;
+  for (const utils::CWeakPtr<TItem>& rHandle : lstHandles)
+  {
+    lstItems.emplace_back(rHandle.GetPtr());
+  }
+
+  // Swap removal: the last dense items are moved into the holes
+  std::vector<utils::CWeakPtr<TItem>> lstRemoved;
+  for (size_t tIndex = 0; tIndex < s_tMaxItems; tIndex += s_tRemoveStep)
+  {
+    TEST_CHECK(pPool->Remove(lstHandles[tIndex]));
+    lstRemoved.emplace_back(lstHandles[tIndex]);
+  }
+  for (const utils::CWeakPtr<TItem>& rRemoved : lstRemoved)
+  {
+    TEST_CHECK(!rRemoved.IsValid() && rRemoved.GetPtr() == nullptr);
+    TEST_CHECK(!pPool->Remove(rRemoved));
+  }
+
+  // Moved items keep their slot: same handle, same address, new dense index
+  uint32_t uMovedItems = 0;
+  for (size_t tIndex = 0; tIndex < s_tMaxItems; ++tIndex)
+  {
+    if (tIndex % s_tRemoveStep != 0)
+    {
+      const size_t tDenseIdx = pPool->FindIndex(lstHandles[tIndex]);
+      TEST_CHECK(lstHandles[tIndex].GetPtr() == lstItems[tIndex] && lstItems[tIndex]->Value == static_cast<int>(tIndex));
+      TEST_CHECK(tDenseIdx < pPool->GetSize() && (*pPool)[tDenseIdx].GetPtr() == lstItems[tIndex]);
+      uMovedItems += tDenseIdx != tIndex ? 1u : 0u;
+    }
+  }
+  TEST_CHECK(uMovedItems > 0u);
+
+  // The freed slots are reused, the old handles stay invalid
+  for (size_t tIndex = 0; tIndex < s_tMaxItems; tIndex += s_tRemoveStep)
+  {
+    lstHandles[tIndex] = pPool->Create(static_cast<int>(tIndex));
+  }
+  for (const utils::CWeakPtr<TItem>& rRemoved : lstRemoved)
+  {
+    TEST_CHECK(!rRemoved.IsValid());
+  }
+  TEST_CHECK(IsPoolConsistent(*pPool, lstHandles));
+
+  pPool->Clear();
+  for (const utils::CWeakPtr<TItem>& rHandle : lstHandles)
+  {
+    TEST_CHECK(!rHandle.IsValid());
+  }
+}
+// ------------------------------------
+TEST_BENCHMARK(FixedPool_FullCapacityChurn)
+{
+  using namespace internal_fixed_pool_tests;
+  static constexpr uint32_t s_uRounds = 1000u;
+
+  std::unique_ptr<TPool> pPool = std::make_unique<TPool>();
+  std::vector<utils::CWeakPtr<TItem>> lstHandles;
+  FillPool(*pPool, lstHandles);
+
+  std::vector<utils::CWeakPtr<TItem>> lstRemoved;
+  uint32_t uOperations = 0;
+  const auto oBegin = std::chrono::steady_clock::now();
+  for (uint32_t uRound = 0; uRound < s_uRounds; ++uRound)
+  {
+    for (size_t tIndex = uRound % s_tRemoveStep; tIndex < s_tMaxItems; tIndex += s_tRemoveStep)
+    {
+      if (uRound == 0u)
+      {
+        lstRemoved.emplace_back(lstHandles[tIndex]);
+      }
+      pPool->Remove(lstHandles[tIndex]);
+      lstHandles[tIndex] = pPool->Create(static_cast<int>(tIndex));
+      uOperations += 2u;
+    }
+  }
+  const double dMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - oBegin).count();
+  printf("  %u create/remove at %zu items: %.2f ms (%.1f ns per operation)\n", uOperations, s_tMaxItems, dMs, dMs * 1e6 / uOperations);
+
+  for (const utils::CWeakPtr<TItem>& rRemoved : lstRemoved)
+  {
+    TEST_CHECK(!rRemoved.IsValid());
+  }
+  TEST_CHECK(IsPoolConsistent(*pPool, lstHandles));
+}
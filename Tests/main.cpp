@@ -0,0 +1,21 @@
+#include "TestFramework.h"
+#include <cstring>
+
+// Tests.exe [--bench] [name filter]
+int main(int _iArgc, char** _pArgv)
+{
+  bool bBenchmarks = false;
+  const char* sFilter = nullptr;
+  for (int iArg = 1; iArg < _iArgc; ++iArg)
+  {
+    if (std::strcmp(_pArgv[iArg], "--bench") == 0)
+    {
+      bBenchmarks = true;
+    }
+    else
+    {
+      sFilter = _pArgv[iArg];
+    }
+  }
+  return tests::CTestRegistry::GetInstance().Run(sFilter, bBenchmarks) == 0 ? 0 : 1;
+}